@@ -30,6 +30,7 @@ import androidx.media3.common.MediaItem
 import androidx.media3.common.PlaybackParameters
 import androidx.media3.common.Player
 import androidx.media3.exoplayer.ExoPlayer
+import androidx.media3.exoplayer.SeekParameters
 import android.content.ComponentCallbacks2
 import android.content.res.Configuration
 import androidx.media3.common.Tracks
@@ -102,7 +103,8 @@ class AvPlayerPlugin : FlutterPlugin, AvPlayerHostApi, ActivityAware, ComponentC
     // Lifecycle
     // =========================================================================
 
-    override fun create(source: VideoSourceMessage, callback: (Result<Long>) -> Unit) {
+    override fun create(source: VideoSourceMessage, callback: (Result<CreateResultMessage>) -> Unit) {
+        val startNs = System.nanoTime()
         val binding = flutterPluginBinding
         val ctx = activity ?: binding?.applicationContext
         if (binding == null || ctx == null) {
@@ -276,7 +278,8 @@ class AvPlayerPlugin : FlutterPlugin, AvPlayerHostApi, ActivityAware, ComponentC
         player.setMediaItem(mediaItem)
         player.prepare()
 
-        callback(Result.success(textureId))
+        val latencyUs = (System.nanoTime() - startNs) / 1000
+        callback(Result.success(CreateResultMessage(textureId, latencyUs)))
     }
 
     private fun startPositionReporting(textureId: Long, instance: PlayerInstance) {
@@ -344,12 +347,20 @@ class AvPlayerPlugin : FlutterPlugin, AvPlayerHostApi, ActivityAware, ComponentC
         callback(Result.success(Unit))
     }
 
-    override fun seekTo(playerId: Long, positionMs: Long, callback: (Result<Unit>) -> Unit) {
+    override fun seekTo(playerId: Long, positionMs: Long, mode: SeekMode, callback: (Result<Unit>) -> Unit) {
         val instance = getPlayerInstance(playerId)
         if (instance == null) {
             callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
             return
         }
+        instance.player.setSeekParameters(
+            when (mode) {
+                SeekMode.ACCURATE -> SeekParameters.EXACT
+                SeekMode.KEYFRAME_BEFORE -> SeekParameters.PREVIOUS_SYNC
+                SeekMode.KEYFRAME_AFTER -> SeekParameters.NEXT_SYNC
+                SeekMode.NEAREST_KEYFRAME -> SeekParameters.CLOSEST_SYNC
+            }
+        )
         instance.player.seekTo(positionMs)
         callback(Result.success(Unit))
     }
@@ -489,6 +500,91 @@ class AvPlayerPlugin : FlutterPlugin, AvPlayerHostApi, ActivityAware, ComponentC
         }
     }
 
+    override fun setRenderSize(playerId: Long, width: Long, height: Long, callback: (Result<Unit>) -> Unit) {
+        if (getPlayerInstance(playerId) == null) {
+            callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
+            return
+        }
+        // ExoPlayer renders into the SurfaceTexture, which the compositor
+        // scales on the GPU, so there is no CPU-side frame to downscale.
+        callback(Result.success(Unit))
+    }
+
+    override fun setNativeColorConversion(playerId: Long, enabled: Boolean, callback: (Result<Unit>) -> Unit) {
+        if (getPlayerInstance(playerId) == null) {
+            callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
+            return
+        }
+        // Color conversion happens in the decoder / SurfaceTexture path.
+        callback(Result.success(Unit))
+    }
+
+    override fun setConversionThreads(playerId: Long, threads: Long, callback: (Result<Unit>) -> Unit) {
+        if (getPlayerInstance(playerId) == null) {
+            callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
+            return
+        }
+        // Decoding and conversion run in MediaCodec.
+        callback(Result.success(Unit))
+    }
+
+    override fun getRenderStats(playerId: Long, callback: (Result<RenderStatsMessage>) -> Unit) {
+        val instance = getPlayerInstance(playerId)
+        if (instance == null) {
+            callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
+            return
+        }
+        // ExoPlayer renders straight to the SurfaceTexture, so only the
+        // decoder counters are available; there is no CPU conversion or copy.
+        val counters = instance.player.videoDecoderCounters
+        counters?.ensureUpdated()
+        val presented = (counters?.renderedOutputBufferCount ?: 0).toLong()
+        val dropped = ((counters?.droppedBufferCount ?: 0) +
+            (counters?.skippedOutputBufferCount ?: 0)).toLong()
+        callback(Result.success(RenderStatsMessage(
+            framesDecoded = presented + dropped,
+            framesPresented = presented,
+            framesDropped = dropped,
+            conversionP50Us = 0, conversionP95Us = 0, conversionP99Us = 0,
+            copyP50Us = 0, copyP95Us = 0, copyP99Us = 0,
+            latenessP50Us = 0, latenessP95Us = 0, latenessP99Us = 0,
+            audioFilterP50Us = 0, audioFilterP95Us = 0, audioFilterP99Us = 0,
+        )))
+    }
+
+    override fun getKeyframes(playerId: Long, callback: (Result<List<Long>>) -> Unit) {
+        if (getPlayerInstance(playerId) == null) {
+            callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
+            return
+        }
+        // ExoPlayer does not expose the sync sample table; seeks can still
+        // snap with SeekParameters.
+        callback(Result.success(emptyList()))
+    }
+
+    override fun queueNext(playerId: Long, source: VideoSourceMessage, callback: (Result<Boolean>) -> Unit) {
+        if (getPlayerInstance(playerId) == null) {
+            callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
+            return
+        }
+        // Not supported yet; the playlist falls back to a new player.
+        callback(Result.success(false))
+    }
+
+    override fun preload(source: VideoSourceMessage, callback: (Result<Unit>) -> Unit) {
+        // No warm pool yet; create() loads the source as usual.
+        callback(Result.success(Unit))
+    }
+
+    override fun setSource(playerId: Long, source: VideoSourceMessage, callback: (Result<Boolean>) -> Unit) {
+        if (getPlayerInstance(playerId) == null) {
+            callback(Result.failure(FlutterError("NO_PLAYER", "Player $playerId not found.", null)))
+            return
+        }
+        // Not supported yet; callers create a new player.
+        callback(Result.success(false))
+    }
+
     // =========================================================================
     // PIP
     // =========================================================================
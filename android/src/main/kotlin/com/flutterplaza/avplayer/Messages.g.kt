@@ -34,6 +34,9 @@ private fun wrapError(exception: Throwable): List<Any?> {
   }
 }
 
+private fun createConnectionError(channelName: String): FlutterError {
+  return FlutterError("channel-error",  "Unable to establish connection on channel: '$channelName'.", "")}
+
 /**
  * Error class for passing custom error details to Flutter via a thrown PlatformException.
  * @property code The error code.
@@ -58,6 +61,19 @@ enum class SourceType(val raw: Int) {
   }
 }
 
+enum class SeekMode(val raw: Int) {
+  ACCURATE(0),
+  KEYFRAME_BEFORE(1),
+  KEYFRAME_AFTER(2),
+  NEAREST_KEYFRAME(3);
+
+  companion object {
+    fun ofRaw(raw: Int): SeekMode? {
+      return values().firstOrNull { it.raw == raw }
+    }
+  }
+}
+
 /** Generated class from Pigeon that represents data sent in messages. */
 data class VideoSourceMessage (
   val type: SourceType,
@@ -273,6 +289,135 @@ data class SelectSubtitleTrackRequest (
     )
   }
 }
+
+/** Generated class from Pigeon that represents data sent in messages. */
+data class RenderStatsMessage (
+  val framesDecoded: Long,
+  val framesPresented: Long,
+  val framesDropped: Long,
+  val conversionP50Us: Long,
+  val conversionP95Us: Long,
+  val conversionP99Us: Long,
+  val copyP50Us: Long,
+  val copyP95Us: Long,
+  val copyP99Us: Long,
+  val latenessP50Us: Long,
+  val latenessP95Us: Long,
+  val latenessP99Us: Long,
+  val audioFilterP50Us: Long,
+  val audioFilterP95Us: Long,
+  val audioFilterP99Us: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): RenderStatsMessage {
+      val framesDecoded = pigeonVar_list[0] as Long
+      val framesPresented = pigeonVar_list[1] as Long
+      val framesDropped = pigeonVar_list[2] as Long
+      val conversionP50Us = pigeonVar_list[3] as Long
+      val conversionP95Us = pigeonVar_list[4] as Long
+      val conversionP99Us = pigeonVar_list[5] as Long
+      val copyP50Us = pigeonVar_list[6] as Long
+      val copyP95Us = pigeonVar_list[7] as Long
+      val copyP99Us = pigeonVar_list[8] as Long
+      val latenessP50Us = pigeonVar_list[9] as Long
+      val latenessP95Us = pigeonVar_list[10] as Long
+      val latenessP99Us = pigeonVar_list[11] as Long
+      val audioFilterP50Us = pigeonVar_list[12] as Long
+      val audioFilterP95Us = pigeonVar_list[13] as Long
+      val audioFilterP99Us = pigeonVar_list[14] as Long
+      return RenderStatsMessage(framesDecoded, framesPresented, framesDropped, conversionP50Us, conversionP95Us, conversionP99Us, copyP50Us, copyP95Us, copyP99Us, latenessP50Us, latenessP95Us, latenessP99Us, audioFilterP50Us, audioFilterP95Us, audioFilterP99Us)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      framesDecoded,
+      framesPresented,
+      framesDropped,
+      conversionP50Us,
+      conversionP95Us,
+      conversionP99Us,
+      copyP50Us,
+      copyP95Us,
+      copyP99Us,
+      latenessP50Us,
+      latenessP95Us,
+      latenessP99Us,
+      audioFilterP50Us,
+      audioFilterP95Us,
+      audioFilterP99Us,
+    )
+  }
+}
+
+/** Generated class from Pigeon that represents data sent in messages. */
+data class CreateResultMessage (
+  val playerId: Long,
+  val createLatencyUs: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): CreateResultMessage {
+      val playerId = pigeonVar_list[0] as Long
+      val createLatencyUs = pigeonVar_list[1] as Long
+      return CreateResultMessage(playerId, createLatencyUs)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      playerId,
+      createLatencyUs,
+    )
+  }
+}
+
+/** Generated class from Pigeon that represents data sent in messages. */
+data class ClockAnchorMessage (
+  val playerId: Long,
+  val positionMs: Long,
+  val rate: Double,
+  val timestampUs: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): ClockAnchorMessage {
+      val playerId = pigeonVar_list[0] as Long
+      val positionMs = pigeonVar_list[1] as Long
+      val rate = pigeonVar_list[2] as Double
+      val timestampUs = pigeonVar_list[3] as Long
+      return ClockAnchorMessage(playerId, positionMs, rate, timestampUs)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      playerId,
+      positionMs,
+      rate,
+      timestampUs,
+    )
+  }
+}
+
+/** Generated class from Pigeon that represents data sent in messages. */
+data class StateUpdateMessage (
+  val playerId: Long,
+  val bufferedMs: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): StateUpdateMessage {
+      val playerId = pigeonVar_list[0] as Long
+      val bufferedMs = pigeonVar_list[1] as Long
+      return StateUpdateMessage(playerId, bufferedMs)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      playerId,
+      bufferedMs,
+    )
+  }
+}
 private open class MessagesPigeonCodec : StandardMessageCodec() {
   override fun readValueOfType(type: Byte, buffer: ByteBuffer): Any? {
     return when (type) {
@@ -282,50 +427,75 @@ private open class MessagesPigeonCodec : StandardMessageCodec() {
         }
       }
       130.toByte() -> {
+        return (readValue(buffer) as Long?)?.let {
+          SeekMode.ofRaw(it.toInt())
+        }
+      }
+      131.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           VideoSourceMessage.fromList(it)
         }
       }
-      131.toByte() -> {
+      132.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           MediaMetadataMessage.fromList(it)
         }
       }
-      132.toByte() -> {
+      133.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           EnterPipRequest.fromList(it)
         }
       }
-      133.toByte() -> {
+      134.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           MediaMetadataRequest.fromList(it)
         }
       }
-      134.toByte() -> {
+      135.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           AbrConfigMessage.fromList(it)
         }
       }
-      135.toByte() -> {
+      136.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           SetAbrConfigRequest.fromList(it)
         }
       }
-      136.toByte() -> {
+      137.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           DecoderInfoMessage.fromList(it)
         }
       }
-      137.toByte() -> {
+      138.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           SubtitleTrackMessage.fromList(it)
         }
       }
-      138.toByte() -> {
+      139.toByte() -> {
         return (readValue(buffer) as? List<Any?>)?.let {
           SelectSubtitleTrackRequest.fromList(it)
         }
       }
+      140.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          RenderStatsMessage.fromList(it)
+        }
+      }
+      141.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          CreateResultMessage.fromList(it)
+        }
+      }
+      142.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          ClockAnchorMessage.fromList(it)
+        }
+      }
+      143.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          StateUpdateMessage.fromList(it)
+        }
+      }
       else -> super.readValueOfType(type, buffer)
     }
   }
@@ -335,40 +505,60 @@ private open class MessagesPigeonCodec : StandardMessageCodec() {
         stream.write(129)
         writeValue(stream, value.raw)
       }
-      is VideoSourceMessage -> {
+      is SeekMode -> {
         stream.write(130)
+        writeValue(stream, value.raw)
+      }
+      is VideoSourceMessage -> {
+        stream.write(131)
         writeValue(stream, value.toList())
       }
       is MediaMetadataMessage -> {
-        stream.write(131)
+        stream.write(132)
         writeValue(stream, value.toList())
       }
       is EnterPipRequest -> {
-        stream.write(132)
+        stream.write(133)
         writeValue(stream, value.toList())
       }
       is MediaMetadataRequest -> {
-        stream.write(133)
+        stream.write(134)
         writeValue(stream, value.toList())
       }
       is AbrConfigMessage -> {
-        stream.write(134)
+        stream.write(135)
         writeValue(stream, value.toList())
       }
       is SetAbrConfigRequest -> {
-        stream.write(135)
+        stream.write(136)
         writeValue(stream, value.toList())
       }
       is DecoderInfoMessage -> {
-        stream.write(136)
+        stream.write(137)
         writeValue(stream, value.toList())
       }
       is SubtitleTrackMessage -> {
-        stream.write(137)
+        stream.write(138)
         writeValue(stream, value.toList())
       }
       is SelectSubtitleTrackRequest -> {
-        stream.write(138)
+        stream.write(139)
+        writeValue(stream, value.toList())
+      }
+      is RenderStatsMessage -> {
+        stream.write(140)
+        writeValue(stream, value.toList())
+      }
+      is CreateResultMessage -> {
+        stream.write(141)
+        writeValue(stream, value.toList())
+      }
+      is ClockAnchorMessage -> {
+        stream.write(142)
+        writeValue(stream, value.toList())
+      }
+      is StateUpdateMessage -> {
+        stream.write(143)
         writeValue(stream, value.toList())
       }
       else -> super.writeValue(stream, value)
@@ -379,11 +569,11 @@ private open class MessagesPigeonCodec : StandardMessageCodec() {
 
 /** Generated interface from Pigeon that represents a handler of messages from Flutter. */
 interface AvPlayerHostApi {
-  fun create(source: VideoSourceMessage, callback: (Result<Long>) -> Unit)
+  fun create(source: VideoSourceMessage, callback: (Result<CreateResultMessage>) -> Unit)
   fun dispose(playerId: Long, callback: (Result<Unit>) -> Unit)
   fun play(playerId: Long, callback: (Result<Unit>) -> Unit)
   fun pause(playerId: Long, callback: (Result<Unit>) -> Unit)
-  fun seekTo(playerId: Long, positionMs: Long, callback: (Result<Unit>) -> Unit)
+  fun seekTo(playerId: Long, positionMs: Long, mode: SeekMode, callback: (Result<Unit>) -> Unit)
   fun setPlaybackSpeed(playerId: Long, speed: Double, callback: (Result<Unit>) -> Unit)
   fun setLooping(playerId: Long, looping: Boolean, callback: (Result<Unit>) -> Unit)
   fun setVolume(playerId: Long, volume: Double, callback: (Result<Unit>) -> Unit)
@@ -401,6 +591,14 @@ interface AvPlayerHostApi {
   fun getDecoderInfo(playerId: Long, callback: (Result<DecoderInfoMessage>) -> Unit)
   fun getSubtitleTracks(playerId: Long, callback: (Result<List<SubtitleTrackMessage>>) -> Unit)
   fun selectSubtitleTrack(request: SelectSubtitleTrackRequest, callback: (Result<Unit>) -> Unit)
+  fun setRenderSize(playerId: Long, width: Long, height: Long, callback: (Result<Unit>) -> Unit)
+  fun setNativeColorConversion(playerId: Long, enabled: Boolean, callback: (Result<Unit>) -> Unit)
+  fun setConversionThreads(playerId: Long, threads: Long, callback: (Result<Unit>) -> Unit)
+  fun getRenderStats(playerId: Long, callback: (Result<RenderStatsMessage>) -> Unit)
+  fun getKeyframes(playerId: Long, callback: (Result<List<Long>>) -> Unit)
+  fun queueNext(playerId: Long, source: VideoSourceMessage, callback: (Result<Boolean>) -> Unit)
+  fun preload(source: VideoSourceMessage, callback: (Result<Unit>) -> Unit)
+  fun setSource(playerId: Long, source: VideoSourceMessage, callback: (Result<Boolean>) -> Unit)
 
   companion object {
     /** The codec used by AvPlayerHostApi. */
@@ -495,7 +693,8 @@ interface AvPlayerHostApi {
             val args = message as List<Any?>
             val playerIdArg = args[0] as Long
             val positionMsArg = args[1] as Long
-            api.seekTo(playerIdArg, positionMsArg) { result: Result<Unit> ->
+            val modeArg = args[2] as SeekMode
+            api.seekTo(playerIdArg, positionMsArg, modeArg) { result: Result<Unit> ->
               val error = result.exceptionOrNull()
               if (error != null) {
                 reply.reply(wrapError(error))
@@ -834,6 +1033,211 @@ interface AvPlayerHostApi {
           channel.setMessageHandler(null)
         }
       }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setRenderSize$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val playerIdArg = args[0] as Long
+            val widthArg = args[1] as Long
+            val heightArg = args[2] as Long
+            api.setRenderSize(playerIdArg, widthArg, heightArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                reply.reply(wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setNativeColorConversion$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val playerIdArg = args[0] as Long
+            val enabledArg = args[1] as Boolean
+            api.setNativeColorConversion(playerIdArg, enabledArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                reply.reply(wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setConversionThreads$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val playerIdArg = args[0] as Long
+            val threadsArg = args[1] as Long
+            api.setConversionThreads(playerIdArg, threadsArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                reply.reply(wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.getRenderStats$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val playerIdArg = args[0] as Long
+            api.getRenderStats(playerIdArg) { result: Result<RenderStatsMessage> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.getKeyframes$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val playerIdArg = args[0] as Long
+            api.getKeyframes(playerIdArg) { result: Result<List<Long>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.queueNext$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val playerIdArg = args[0] as Long
+            val sourceArg = args[1] as VideoSourceMessage
+            api.queueNext(playerIdArg, sourceArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.preload$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val sourceArg = args[0] as VideoSourceMessage
+            api.preload(sourceArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                reply.reply(wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setSource$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val playerIdArg = args[0] as Long
+            val sourceArg = args[1] as VideoSourceMessage
+            api.setSource(playerIdArg, sourceArg) { result: Result<Boolean> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+    }
+  }
+}
+/** Generated class from Pigeon that represents Flutter messages that can be called from Kotlin. */
+class AvPlayerEventApi(private val binaryMessenger: BinaryMessenger, private val messageChannelSuffix: String = "") {
+  companion object {
+    /** The codec used by AvPlayerEventApi. */
+    val codec: MessageCodec<Any?> by lazy {
+      MessagesPigeonCodec()
+    }
+  }
+  fun onClockAnchor(anchorArg: ClockAnchorMessage, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.av_player.AvPlayerEventApi.onClockAnchor$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(anchorArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(createConnectionError(channelName)))
+      } 
+    }
+  }
+  fun onStateUpdate(updateArg: StateUpdateMessage, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.av_player.AvPlayerEventApi.onStateUpdate$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(updateArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(createConnectionError(channelName)))
+      } 
     }
   }
 }
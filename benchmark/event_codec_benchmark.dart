@@ -0,0 +1,98 @@
+// Times a periodic event's trip through the platform codecs: the
+// string-keyed map the event channel used to carry against the typed
+// AvPlayerEventApi message. Each iteration encodes as the platform does,
+// decodes as Dart does and builds the AVPlayerEvent, so the map lookups
+// and casts of AVPlayerEvent.fromMap are counted too.
+//
+// Both codecs share the standard message wire format with the Linux
+// FlStandardMessageCodec, so the encoding side mirrors the native one in
+// kind; the native FlValue building itself is not measured here.
+//
+// Run with: flutter test benchmark/event_codec_benchmark.dart
+
+// ignore_for_file: avoid_print
+
+import 'package:av_player/src/platform/generated/messages.g.dart';
+import 'package:av_player/src/platform/types.dart';
+import 'package:flutter/services.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+const int _warmupIterations = 20000;
+const int _iterations = 200000;
+
+const StandardMethodCodec _eventCodec = StandardMethodCodec();
+const MessageCodec<Object?> _apiCodec = AvPlayerEventApi.pigeonChannelCodec;
+
+AVPlayerEvent _clockAnchorViaMap(int i) {
+  final data = _eventCodec.encodeSuccessEnvelope(<String, Object?>{
+    'type': 'clockAnchor',
+    'position': 3600000 + i,
+    'rate': 1.0,
+    'timestamp': 987654321012 + i,
+  });
+  return AVPlayerEvent.fromMap(
+      _eventCodec.decodeEnvelope(data) as Map<Object?, Object?>);
+}
+
+AVPlayerEvent _clockAnchorTyped(int i) {
+  final data = _apiCodec.encodeMessage(<Object?>[
+    ClockAnchorMessage(
+      playerId: 42,
+      positionMs: 3600000 + i,
+      rate: 1.0,
+      timestampUs: 987654321012 + i,
+    ),
+  ]);
+  final message = _apiCodec.decodeMessage(data)! as List<Object?>;
+  final anchor = message[0]! as ClockAnchorMessage;
+  return AVClockAnchorEvent(
+    position: Duration(milliseconds: anchor.positionMs),
+    rate: anchor.rate,
+    timestampUs: anchor.timestampUs,
+  );
+}
+
+AVPlayerEvent _stateUpdateViaMap(int i) {
+  final data = _eventCodec.encodeSuccessEnvelope(
+      <String, Object?>{'type': 'stateUpdate', 'buffered': 3600000 + i});
+  return AVPlayerEvent.fromMap(
+      _eventCodec.decodeEnvelope(data) as Map<Object?, Object?>);
+}
+
+AVPlayerEvent _stateUpdateTyped(int i) {
+  final data = _apiCodec.encodeMessage(<Object?>[
+    StateUpdateMessage(playerId: 42, bufferedMs: 3600000 + i),
+  ]);
+  final message = _apiCodec.decodeMessage(data)! as List<Object?>;
+  final update = message[0]! as StateUpdateMessage;
+  return AVStateUpdateEvent(
+      buffered: Duration(milliseconds: update.bufferedMs));
+}
+
+// Nanoseconds per event.
+double _time(AVPlayerEvent Function(int i) run) {
+  for (var i = 0; i < _warmupIterations; i++) {
+    run(i);
+  }
+  final stopwatch = Stopwatch()..start();
+  for (var i = 0; i < _iterations; i++) {
+    run(i);
+  }
+  return stopwatch.elapsedMicroseconds * 1000 / _iterations;
+}
+
+void _compare(String name, AVPlayerEvent Function(int i) viaMap,
+    AVPlayerEvent Function(int i) typed) {
+  final mapNs = _time(viaMap);
+  final typedNs = _time(typed);
+  print('${name.padRight(12)} map ${mapNs.toStringAsFixed(0).padLeft(6)} ns'
+      '  typed ${typedNs.toStringAsFixed(0).padLeft(6)} ns'
+      '  ${(mapNs / typedNs).toStringAsFixed(2)}x');
+}
+
+void main() {
+  test('periodic event codec cost', () {
+    _compare('clockAnchor', _clockAnchorViaMap, _clockAnchorTyped);
+    _compare('stateUpdate', _stateUpdateViaMap, _stateUpdateTyped);
+  });
+}
@@ -419,7 +419,43 @@ void main() {
   });
 
   // -------------------------------------------------------------------------
-  // 12. Multiple simultaneous players
+  // 12. Source swap
+  // -------------------------------------------------------------------------
+
+  group('Source swap', () {
+    testWidgets('setSource while playing initializes the new source',
+        (tester) async {
+      await tester.runAsync(() async {
+        final controller = AVPlayerController(
+          const AVVideoSource.network(_networkUrl),
+        );
+
+        try {
+          await _initAndWait(controller);
+          await controller.play();
+          await waitForCondition(() => controller.value.isPlaying);
+
+          final swapped = await controller.setSource(
+            const AVVideoSource.network(_networkUrl2),
+          );
+          // Only platforms that swap in place report true.
+          if (!swapped) return;
+
+          await waitForCondition(
+            () => controller.value.isInitialized || controller.value.hasError,
+          );
+          expect(controller.value.hasError, isFalse);
+          expect(controller.value.duration, greaterThan(Duration.zero));
+          expect(controller.value.isPlaying, isFalse);
+        } finally {
+          controller.dispose();
+        }
+      });
+    });
+  });
+
+  // -------------------------------------------------------------------------
+  // 13. Multiple simultaneous players
   // -------------------------------------------------------------------------
 
   group('Multiple simultaneous players', () {
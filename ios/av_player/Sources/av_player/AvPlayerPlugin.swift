@@ -37,6 +37,17 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         return .success(instance)
     }
 
+    // Seek tolerances for a seek mode: zero on both sides for an accurate
+    // seek, unbounded on the side a keyframe may be picked from.
+    private func seekTolerances(_ mode: SeekMode) -> (CMTime, CMTime) {
+        switch mode {
+        case .accurate: return (.zero, .zero)
+        case .keyframeBefore: return (.positiveInfinity, .zero)
+        case .keyframeAfter: return (.zero, .positiveInfinity)
+        case .nearestKeyframe: return (.positiveInfinity, .positiveInfinity)
+        }
+    }
+
     private static var keyWindowRootView: UIView? {
         if #available(iOS 15.0, *) {
             return UIApplication.shared.connectedScenes
@@ -55,7 +66,8 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
     // MARK: - AvPlayerHostApi: Lifecycle
     // =========================================================================
 
-    func create(source: VideoSourceMessage, completion: @escaping (Result<Int64, Error>) -> Void) {
+    func create(source: VideoSourceMessage, completion: @escaping (Result<CreateResultMessage, Error>) -> Void) {
+        let start = DispatchTime.now().uptimeNanoseconds
         let videoURL: URL
 
         switch source.type {
@@ -152,7 +164,8 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         instance.startDisplayLink()
 
         players[textureId] = instance
-        completion(.success(textureId))
+        let latencyUs = Int64((DispatchTime.now().uptimeNanoseconds - start) / 1000)
+        completion(.success(CreateResultMessage(playerId: textureId, createLatencyUs: latencyUs)))
     }
 
     func dispose(playerId: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
@@ -193,11 +206,12 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         }
     }
 
-    func seekTo(playerId: Int64, positionMs: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
+    func seekTo(playerId: Int64, positionMs: Int64, mode: SeekMode, completion: @escaping (Result<Void, Error>) -> Void) {
         switch getPlayer(playerId) {
         case .success(let instance):
             let time = CMTime(value: positionMs, timescale: 1000)
-            instance.player.seek(to: time, toleranceBefore: .zero, toleranceAfter: .zero) { _ in
+            let (before, after) = seekTolerances(mode)
+            instance.player.seek(to: time, toleranceBefore: before, toleranceAfter: after) { _ in
                 completion(.success(()))
             }
         case .failure(let error):
@@ -318,6 +332,91 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         }
     }
 
+    func setRenderSize(playerId: Int64, width: Int64, height: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
+        switch getPlayer(playerId) {
+        case .success:
+            // AVPlayerItemVideoOutput frames are handed to Flutter as
+            // IOSurface-backed pixel buffers and scaled on the GPU.
+            completion(.success(()))
+        case .failure(let error):
+            completion(.failure(error))
+        }
+    }
+
+    func setNativeColorConversion(playerId: Int64, enabled: Bool, completion: @escaping (Result<Void, Error>) -> Void) {
+        switch getPlayer(playerId) {
+        case .success:
+            // AVPlayerItemVideoOutput already delivers BGRA converted by
+            // VideoToolbox.
+            completion(.success(()))
+        case .failure(let error):
+            completion(.failure(error))
+        }
+    }
+
+    func setConversionThreads(playerId: Int64, threads: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
+        switch getPlayer(playerId) {
+        case .success:
+            // VideoToolbox schedules conversion work itself.
+            completion(.success(()))
+        case .failure(let error):
+            completion(.failure(error))
+        }
+    }
+
+    func getRenderStats(playerId: Int64, completion: @escaping (Result<RenderStatsMessage, Error>) -> Void) {
+        switch getPlayer(playerId) {
+        case .success:
+            // AVPlayerItemVideoOutput hands frames to the engine without a
+            // conversion or copy step to time.
+            completion(.success(RenderStatsMessage(
+                framesDecoded: 0, framesPresented: 0, framesDropped: 0,
+                conversionP50Us: 0, conversionP95Us: 0, conversionP99Us: 0,
+                copyP50Us: 0, copyP95Us: 0, copyP99Us: 0,
+                latenessP50Us: 0, latenessP95Us: 0, latenessP99Us: 0,
+                audioFilterP50Us: 0, audioFilterP95Us: 0, audioFilterP99Us: 0
+            )))
+        case .failure(let error):
+            completion(.failure(error))
+        }
+    }
+
+    func getKeyframes(playerId: Int64, completion: @escaping (Result<[Int64], Error>) -> Void) {
+        switch getPlayer(playerId) {
+        case .success:
+            // AVPlayer does not expose sync samples; seeks can still snap
+            // through the seek tolerances.
+            completion(.success([]))
+        case .failure(let error):
+            completion(.failure(error))
+        }
+    }
+
+    func queueNext(playerId: Int64, source: VideoSourceMessage, completion: @escaping (Result<Bool, Error>) -> Void) {
+        switch getPlayer(playerId) {
+        case .success:
+            // Needs AVQueuePlayer; the playlist falls back to a new player.
+            completion(.success(false))
+        case .failure(let error):
+            completion(.failure(error))
+        }
+    }
+
+    func preload(source: VideoSourceMessage, completion: @escaping (Result<Void, Error>) -> Void) {
+        // No warm pool yet; create() loads the source as usual.
+        completion(.success(()))
+    }
+
+    func setSource(playerId: Int64, source: VideoSourceMessage, completion: @escaping (Result<Bool, Error>) -> Void) {
+        switch getPlayer(playerId) {
+        case .success:
+            // Not supported yet; callers create a new player.
+            completion(.success(false))
+        case .failure(let error):
+            completion(.failure(error))
+        }
+    }
+
     // =========================================================================
     // MARK: - AvPlayerHostApi: Performance
     // =========================================================================
@@ -55,6 +55,10 @@ private func wrapError(_ error: Any) -> [Any?] {
   ]
 }
 
+private func createConnectionError(withChannelName channelName: String) -> PigeonError {
+  return PigeonError(code: "channel-error", message: "Unable to establish connection on channel: '\(channelName)'.", details: "")
+}
+
 private func isNullish(_ value: Any?) -> Bool {
   return value is NSNull || value == nil
 }
@@ -70,6 +74,13 @@ enum SourceType: Int {
   case file = 2
 }
 
+enum SeekMode: Int {
+  case accurate = 0
+  case keyframeBefore = 1
+  case keyframeAfter = 2
+  case nearestKeyframe = 3
+}
+
 /// Generated class from Pigeon that represents data sent in messages.
 struct VideoSourceMessage {
   var type: SourceType
@@ -322,6 +333,161 @@ struct SelectSubtitleTrackRequest {
   }
 }
 
+/// Generated class from Pigeon that represents data sent in messages.
+struct RenderStatsMessage {
+  var framesDecoded: Int64
+  var framesPresented: Int64
+  var framesDropped: Int64
+  var conversionP50Us: Int64
+  var conversionP95Us: Int64
+  var conversionP99Us: Int64
+  var copyP50Us: Int64
+  var copyP95Us: Int64
+  var copyP99Us: Int64
+  var latenessP50Us: Int64
+  var latenessP95Us: Int64
+  var latenessP99Us: Int64
+  var audioFilterP50Us: Int64
+  var audioFilterP95Us: Int64
+  var audioFilterP99Us: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> RenderStatsMessage? {
+    let framesDecoded = pigeonVar_list[0] as! Int64
+    let framesPresented = pigeonVar_list[1] as! Int64
+    let framesDropped = pigeonVar_list[2] as! Int64
+    let conversionP50Us = pigeonVar_list[3] as! Int64
+    let conversionP95Us = pigeonVar_list[4] as! Int64
+    let conversionP99Us = pigeonVar_list[5] as! Int64
+    let copyP50Us = pigeonVar_list[6] as! Int64
+    let copyP95Us = pigeonVar_list[7] as! Int64
+    let copyP99Us = pigeonVar_list[8] as! Int64
+    let latenessP50Us = pigeonVar_list[9] as! Int64
+    let latenessP95Us = pigeonVar_list[10] as! Int64
+    let latenessP99Us = pigeonVar_list[11] as! Int64
+    let audioFilterP50Us = pigeonVar_list[12] as! Int64
+    let audioFilterP95Us = pigeonVar_list[13] as! Int64
+    let audioFilterP99Us = pigeonVar_list[14] as! Int64
+
+    return RenderStatsMessage(
+      framesDecoded: framesDecoded,
+      framesPresented: framesPresented,
+      framesDropped: framesDropped,
+      conversionP50Us: conversionP50Us,
+      conversionP95Us: conversionP95Us,
+      conversionP99Us: conversionP99Us,
+      copyP50Us: copyP50Us,
+      copyP95Us: copyP95Us,
+      copyP99Us: copyP99Us,
+      latenessP50Us: latenessP50Us,
+      latenessP95Us: latenessP95Us,
+      latenessP99Us: latenessP99Us,
+      audioFilterP50Us: audioFilterP50Us,
+      audioFilterP95Us: audioFilterP95Us,
+      audioFilterP99Us: audioFilterP99Us
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      framesDecoded,
+      framesPresented,
+      framesDropped,
+      conversionP50Us,
+      conversionP95Us,
+      conversionP99Us,
+      copyP50Us,
+      copyP95Us,
+      copyP99Us,
+      latenessP50Us,
+      latenessP95Us,
+      latenessP99Us,
+      audioFilterP50Us,
+      audioFilterP95Us,
+      audioFilterP99Us,
+    ]
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct CreateResultMessage {
+  var playerId: Int64
+  var createLatencyUs: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> CreateResultMessage? {
+    let playerId = pigeonVar_list[0] as! Int64
+    let createLatencyUs = pigeonVar_list[1] as! Int64
+
+    return CreateResultMessage(
+      playerId: playerId,
+      createLatencyUs: createLatencyUs
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      playerId,
+      createLatencyUs,
+    ]
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct ClockAnchorMessage {
+  var playerId: Int64
+  var positionMs: Int64
+  var rate: Double
+  var timestampUs: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> ClockAnchorMessage? {
+    let playerId = pigeonVar_list[0] as! Int64
+    let positionMs = pigeonVar_list[1] as! Int64
+    let rate = pigeonVar_list[2] as! Double
+    let timestampUs = pigeonVar_list[3] as! Int64
+
+    return ClockAnchorMessage(
+      playerId: playerId,
+      positionMs: positionMs,
+      rate: rate,
+      timestampUs: timestampUs
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      playerId,
+      positionMs,
+      rate,
+      timestampUs,
+    ]
+  }
+}
+
+/// Generated class from Pigeon that represents data sent in messages.
+struct StateUpdateMessage {
+  var playerId: Int64
+  var bufferedMs: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> StateUpdateMessage? {
+    let playerId = pigeonVar_list[0] as! Int64
+    let bufferedMs = pigeonVar_list[1] as! Int64
+
+    return StateUpdateMessage(
+      playerId: playerId,
+      bufferedMs: bufferedMs
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      playerId,
+      bufferedMs,
+    ]
+  }
+}
 private class MessagesPigeonCodecReader: FlutterStandardReader {
   override func readValue(ofType type: UInt8) -> Any? {
     switch type {
@@ -332,23 +498,37 @@ private class MessagesPigeonCodecReader: FlutterStandardReader {
       }
       return nil
     case 130:
-      return VideoSourceMessage.fromList(self.readValue() as! [Any?])
+      let enumResultAsInt: Int? = nilOrValue(self.readValue() as! Int?)
+      if let enumResultAsInt = enumResultAsInt {
+        return SeekMode(rawValue: enumResultAsInt)
+      }
+      return nil
     case 131:
-      return MediaMetadataMessage.fromList(self.readValue() as! [Any?])
+      return VideoSourceMessage.fromList(self.readValue() as! [Any?])
     case 132:
-      return EnterPipRequest.fromList(self.readValue() as! [Any?])
+      return MediaMetadataMessage.fromList(self.readValue() as! [Any?])
     case 133:
-      return MediaMetadataRequest.fromList(self.readValue() as! [Any?])
+      return EnterPipRequest.fromList(self.readValue() as! [Any?])
     case 134:
-      return AbrConfigMessage.fromList(self.readValue() as! [Any?])
+      return MediaMetadataRequest.fromList(self.readValue() as! [Any?])
     case 135:
-      return SetAbrConfigRequest.fromList(self.readValue() as! [Any?])
+      return AbrConfigMessage.fromList(self.readValue() as! [Any?])
     case 136:
-      return DecoderInfoMessage.fromList(self.readValue() as! [Any?])
+      return SetAbrConfigRequest.fromList(self.readValue() as! [Any?])
     case 137:
-      return SubtitleTrackMessage.fromList(self.readValue() as! [Any?])
+      return DecoderInfoMessage.fromList(self.readValue() as! [Any?])
     case 138:
+      return SubtitleTrackMessage.fromList(self.readValue() as! [Any?])
+    case 139:
       return SelectSubtitleTrackRequest.fromList(self.readValue() as! [Any?])
+    case 140:
+      return RenderStatsMessage.fromList(self.readValue() as! [Any?])
+    case 141:
+      return CreateResultMessage.fromList(self.readValue() as! [Any?])
+    case 142:
+      return ClockAnchorMessage.fromList(self.readValue() as! [Any?])
+    case 143:
+      return StateUpdateMessage.fromList(self.readValue() as! [Any?])
     default:
       return super.readValue(ofType: type)
     }
@@ -360,32 +540,47 @@ private class MessagesPigeonCodecWriter: FlutterStandardWriter {
     if let value = value as? SourceType {
       super.writeByte(129)
       super.writeValue(value.rawValue)
-    } else if let value = value as? VideoSourceMessage {
+    } else if let value = value as? SeekMode {
       super.writeByte(130)
+      super.writeValue(value.rawValue)
+    } else if let value = value as? VideoSourceMessage {
+      super.writeByte(131)
       super.writeValue(value.toList())
     } else if let value = value as? MediaMetadataMessage {
-      super.writeByte(131)
+      super.writeByte(132)
       super.writeValue(value.toList())
     } else if let value = value as? EnterPipRequest {
-      super.writeByte(132)
+      super.writeByte(133)
       super.writeValue(value.toList())
     } else if let value = value as? MediaMetadataRequest {
-      super.writeByte(133)
+      super.writeByte(134)
       super.writeValue(value.toList())
     } else if let value = value as? AbrConfigMessage {
-      super.writeByte(134)
+      super.writeByte(135)
       super.writeValue(value.toList())
     } else if let value = value as? SetAbrConfigRequest {
-      super.writeByte(135)
+      super.writeByte(136)
       super.writeValue(value.toList())
     } else if let value = value as? DecoderInfoMessage {
-      super.writeByte(136)
+      super.writeByte(137)
       super.writeValue(value.toList())
     } else if let value = value as? SubtitleTrackMessage {
-      super.writeByte(137)
+      super.writeByte(138)
       super.writeValue(value.toList())
     } else if let value = value as? SelectSubtitleTrackRequest {
-      super.writeByte(138)
+      super.writeByte(139)
+      super.writeValue(value.toList())
+    } else if let value = value as? RenderStatsMessage {
+      super.writeByte(140)
+      super.writeValue(value.toList())
+    } else if let value = value as? CreateResultMessage {
+      super.writeByte(141)
+      super.writeValue(value.toList())
+    } else if let value = value as? ClockAnchorMessage {
+      super.writeByte(142)
+      super.writeValue(value.toList())
+    } else if let value = value as? StateUpdateMessage {
+      super.writeByte(143)
       super.writeValue(value.toList())
     } else {
       super.writeValue(value)
@@ -410,11 +605,11 @@ class MessagesPigeonCodec: FlutterStandardMessageCodec, @unchecked Sendable {
 
 /// Generated protocol from Pigeon that represents a handler of messages from Flutter.
 protocol AvPlayerHostApi {
-  func create(source: VideoSourceMessage, completion: @escaping (Result<Int64, Error>) -> Void)
+  func create(source: VideoSourceMessage, completion: @escaping (Result<CreateResultMessage, Error>) -> Void)
   func dispose(playerId: Int64, completion: @escaping (Result<Void, Error>) -> Void)
   func play(playerId: Int64, completion: @escaping (Result<Void, Error>) -> Void)
   func pause(playerId: Int64, completion: @escaping (Result<Void, Error>) -> Void)
-  func seekTo(playerId: Int64, positionMs: Int64, completion: @escaping (Result<Void, Error>) -> Void)
+  func seekTo(playerId: Int64, positionMs: Int64, mode: SeekMode, completion: @escaping (Result<Void, Error>) -> Void)
   func setPlaybackSpeed(playerId: Int64, speed: Double, completion: @escaping (Result<Void, Error>) -> Void)
   func setLooping(playerId: Int64, looping: Bool, completion: @escaping (Result<Void, Error>) -> Void)
   func setVolume(playerId: Int64, volume: Double, completion: @escaping (Result<Void, Error>) -> Void)
@@ -432,6 +627,14 @@ protocol AvPlayerHostApi {
   func getDecoderInfo(playerId: Int64, completion: @escaping (Result<DecoderInfoMessage, Error>) -> Void)
   func getSubtitleTracks(playerId: Int64, completion: @escaping (Result<[SubtitleTrackMessage], Error>) -> Void)
   func selectSubtitleTrack(request: SelectSubtitleTrackRequest, completion: @escaping (Result<Void, Error>) -> Void)
+  func setRenderSize(playerId: Int64, width: Int64, height: Int64, completion: @escaping (Result<Void, Error>) -> Void)
+  func setNativeColorConversion(playerId: Int64, enabled: Bool, completion: @escaping (Result<Void, Error>) -> Void)
+  func setConversionThreads(playerId: Int64, threads: Int64, completion: @escaping (Result<Void, Error>) -> Void)
+  func getRenderStats(playerId: Int64, completion: @escaping (Result<RenderStatsMessage, Error>) -> Void)
+  func getKeyframes(playerId: Int64, completion: @escaping (Result<[Int64], Error>) -> Void)
+  func queueNext(playerId: Int64, source: VideoSourceMessage, completion: @escaping (Result<Bool, Error>) -> Void)
+  func preload(source: VideoSourceMessage, completion: @escaping (Result<Void, Error>) -> Void)
+  func setSource(playerId: Int64, source: VideoSourceMessage, completion: @escaping (Result<Bool, Error>) -> Void)
 }
 
 /// Generated setup class from Pigeon to handle messages through the `binaryMessenger`.
@@ -514,7 +717,8 @@ class AvPlayerHostApiSetup {
         let args = message as! [Any?]
         let playerIdArg = args[0] as! Int64
         let positionMsArg = args[1] as! Int64
-        api.seekTo(playerId: playerIdArg, positionMs: positionMsArg) { result in
+        let modeArg = args[2] as! SeekMode
+        api.seekTo(playerId: playerIdArg, positionMs: positionMsArg, mode: modeArg) { result in
           switch result {
           case .success:
             reply(wrapResult(nil))
@@ -813,5 +1017,199 @@ class AvPlayerHostApiSetup {
     } else {
       selectSubtitleTrackChannel.setMessageHandler(nil)
     }
+    let setRenderSizeChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.setRenderSize\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setRenderSizeChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let playerIdArg = args[0] as! Int64
+        let widthArg = args[1] as! Int64
+        let heightArg = args[2] as! Int64
+        api.setRenderSize(playerId: playerIdArg, width: widthArg, height: heightArg) { result in
+          switch result {
+          case .success:
+            reply(wrapResult(nil))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setRenderSizeChannel.setMessageHandler(nil)
+    }
+    let setNativeColorConversionChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.setNativeColorConversion\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setNativeColorConversionChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let playerIdArg = args[0] as! Int64
+        let enabledArg = args[1] as! Bool
+        api.setNativeColorConversion(playerId: playerIdArg, enabled: enabledArg) { result in
+          switch result {
+          case .success:
+            reply(wrapResult(nil))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setNativeColorConversionChannel.setMessageHandler(nil)
+    }
+    let setConversionThreadsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.setConversionThreads\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setConversionThreadsChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let playerIdArg = args[0] as! Int64
+        let threadsArg = args[1] as! Int64
+        api.setConversionThreads(playerId: playerIdArg, threads: threadsArg) { result in
+          switch result {
+          case .success:
+            reply(wrapResult(nil))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setConversionThreadsChannel.setMessageHandler(nil)
+    }
+    let getRenderStatsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.getRenderStats\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getRenderStatsChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let playerIdArg = args[0] as! Int64
+        api.getRenderStats(playerId: playerIdArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getRenderStatsChannel.setMessageHandler(nil)
+    }
+    let getKeyframesChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.getKeyframes\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getKeyframesChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let playerIdArg = args[0] as! Int64
+        api.getKeyframes(playerId: playerIdArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getKeyframesChannel.setMessageHandler(nil)
+    }
+    let queueNextChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.queueNext\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      queueNextChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let playerIdArg = args[0] as! Int64
+        let sourceArg = args[1] as! VideoSourceMessage
+        api.queueNext(playerId: playerIdArg, source: sourceArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      queueNextChannel.setMessageHandler(nil)
+    }
+    let preloadChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.preload\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      preloadChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let sourceArg = args[0] as! VideoSourceMessage
+        api.preload(source: sourceArg) { result in
+          switch result {
+          case .success:
+            reply(wrapResult(nil))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      preloadChannel.setMessageHandler(nil)
+    }
+    let setSourceChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.av_player.AvPlayerHostApi.setSource\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setSourceChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let playerIdArg = args[0] as! Int64
+        let sourceArg = args[1] as! VideoSourceMessage
+        api.setSource(playerId: playerIdArg, source: sourceArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setSourceChannel.setMessageHandler(nil)
+    }
+  }
+}
+/// Generated protocol from Pigeon that represents Flutter messages that can be called from Swift.
+protocol AvPlayerEventApiProtocol {
+  func onClockAnchor(anchor anchorArg: ClockAnchorMessage, completion: @escaping (Result<Void, PigeonError>) -> Void)
+  func onStateUpdate(update updateArg: StateUpdateMessage, completion: @escaping (Result<Void, PigeonError>) -> Void)
+}
+class AvPlayerEventApi: AvPlayerEventApiProtocol {
+  private let binaryMessenger: FlutterBinaryMessenger
+  private let messageChannelSuffix: String
+  init(binaryMessenger: FlutterBinaryMessenger, messageChannelSuffix: String = "") {
+    self.binaryMessenger = binaryMessenger
+    self.messageChannelSuffix = messageChannelSuffix.count > 0 ? ".\(messageChannelSuffix)" : ""
+  }
+  var codec: MessagesPigeonCodec {
+    return MessagesPigeonCodec.shared
+  }
+  func onClockAnchor(anchor anchorArg: ClockAnchorMessage, completion: @escaping (Result<Void, PigeonError>) -> Void) {
+    let channelName: String = "dev.flutter.pigeon.av_player.AvPlayerEventApi.onClockAnchor\(messageChannelSuffix)"
+    let channel = FlutterBasicMessageChannel(name: channelName, binaryMessenger: binaryMessenger, codec: codec)
+    channel.sendMessage([anchorArg] as [Any?]) { response in
+      guard let listResponse = response as? [Any?] else {
+        completion(.failure(createConnectionError(withChannelName: channelName)))
+        return
+      }
+      if listResponse.count > 1 {
+        let code: String = listResponse[0] as! String
+        let message: String? = nilOrValue(listResponse[1])
+        let details: String? = nilOrValue(listResponse[2])
+        completion(.failure(PigeonError(code: code, message: message, details: details)))
+      } else {
+        completion(.success(Void()))
+      }
+    }
+  }
+  func onStateUpdate(update updateArg: StateUpdateMessage, completion: @escaping (Result<Void, PigeonError>) -> Void) {
+    let channelName: String = "dev.flutter.pigeon.av_player.AvPlayerEventApi.onStateUpdate\(messageChannelSuffix)"
+    let channel = FlutterBasicMessageChannel(name: channelName, binaryMessenger: binaryMessenger, codec: codec)
+    channel.sendMessage([updateArg] as [Any?]) { response in
+      guard let listResponse = response as? [Any?] else {
+        completion(.failure(createConnectionError(withChannelName: channelName)))
+        return
+      }
+      if listResponse.count > 1 {
+        let code: String = listResponse[0] as! String
+        let message: String? = nilOrValue(listResponse[1])
+        let details: String? = nilOrValue(listResponse[2])
+        completion(.failure(PigeonError(code: code, message: message, details: details)))
+      } else {
+        completion(.success(Void()))
+      }
+    }
   }
 }
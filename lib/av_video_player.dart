@@ -22,14 +22,20 @@ export 'src/platform/av_player_platform.dart'
         AVPositionChangedEvent,
         AVPlaybackStateChangedEvent,
         AVBufferingUpdateEvent,
+        AVStateUpdateEvent,
+        AVClockAnchorEvent,
         AVPipChangedEvent,
         AVCompletedEvent,
+        AVTrackChangedEvent,
         AVErrorEvent,
         AVMediaCommandEvent,
         AVMediaCommand,
         AVPlaybackState,
         AVAbrConfig,
         AVDecoderInfo,
+        AVLatencyPercentiles,
+        AVRenderStats,
+        AVSeekMode,
         AVMemoryPressureLevel,
         AVAbrInfoEvent,
         AVMemoryPressureEvent,
@@ -170,7 +176,7 @@ class AVPlayerState {
 /// await controller.play();
 /// ```
 class AVPlayerController extends ValueNotifier<AVPlayerState> {
-  AVPlayerController(this.source, {this.onMediaCommand})
+  AVPlayerController(this.source, {this.onMediaCommand, this.onTrackChanged})
       : super(const AVPlayerState());
 
   final AVVideoSource source;
@@ -180,11 +186,34 @@ class AVPlayerController extends ValueNotifier<AVPlayerState> {
   final void Function(AVMediaCommand command, {Duration? seekPosition})?
       onMediaCommand;
 
+  /// Called when a source queued with [queueNext] starts playing.
+  /// Use this to queue the source after it.
+  final VoidCallback? onTrackChanged;
+
   static AvPlayerPlatform get _platform => AvPlayerPlatform.instance;
 
   int? _playerId;
   StreamSubscription<AVPlayerEvent>? _eventSubscription;
 
+  // Latest clock anchor, on platforms that send them, re-stamped onto
+  // monotonicMicros by _anchorTimeUs. While it advances, _clockTimer
+  // refreshes value.position from it without platform calls.
+  AVClockAnchorEvent? _clockAnchor;
+  Timer? _clockTimer;
+  // Smallest arrival time minus platform timestamp seen so far.
+  int? _anchorOffsetUs;
+
+  // An anchor delivered this much later than the fastest one means the
+  // platform clock jumped or is not monotonic, so the offset starts over.
+  static const int _maxAnchorDelayUs = 1000000;
+
+  static final Stopwatch _stopwatch = Stopwatch()..start();
+
+  /// Monotonic clock in microseconds that arriving clock anchors are
+  /// re-stamped onto, so extrapolation never reads the platform's clock.
+  @visibleForTesting
+  static int Function() monotonicMicros = () => _stopwatch.elapsedMicroseconds;
+
   // Subtitle state
   final List<AVSubtitleTrack> _externalTracks = [];
   final Map<String, List<AVSubtitleCue>> _externalCues = {};
@@ -200,6 +229,54 @@ class AVPlayerController extends ValueNotifier<AVPlayerState> {
   /// Whether the controller has been initialized.
   bool get isInitialized => value.isInitialized;
 
+  /// The playback position right now.
+  ///
+  /// Where the platform sends clock anchors (Linux) this is extrapolated
+  /// from the latest one, so reading it once per frame, e.g. from a ticker,
+  /// gives smooth progress bars and subtitle timing. [AVPlayerState.position] is
+  /// refreshed from it every 200 ms. Elsewhere it equals
+  /// [AVPlayerState.position].
+  Duration get currentPosition {
+    final anchor = _clockAnchor;
+    if (anchor == null) return value.position;
+    final position = anchor.positionAt(monotonicMicros());
+    final duration = value.duration;
+    return duration > Duration.zero && position > duration ? duration : position;
+  }
+
+  // Maps a clock anchor's platform timestamp onto monotonicMicros.
+  //
+  // The two clocks cannot be compared directly, but arrival time minus
+  // platform timestamp is their offset plus the delivery delay. Its smallest
+  // value so far stands for the offset plus the fastest delivery, so an
+  // anchor that took longer to arrive is dated back by the difference
+  // instead of starting its extrapolation late.
+  int _anchorTimeUs(int platformUs) {
+    final arrivalUs = monotonicMicros();
+    final offsetUs = arrivalUs - platformUs;
+    final minOffsetUs = _anchorOffsetUs;
+    if (minOffsetUs == null ||
+        offsetUs < minOffsetUs ||
+        offsetUs - minOffsetUs > _maxAnchorDelayUs) {
+      _anchorOffsetUs = offsetUs;
+      return arrivalUs;
+    }
+    return platformUs + minOffsetUs;
+  }
+
+  void _setClockAnchor(AVClockAnchorEvent? anchor) {
+    _clockAnchor = anchor;
+    _clockTimer?.cancel();
+    _clockTimer = null;
+    if (anchor == null) return;
+    value = value.copyWith(position: currentPosition);
+    if (anchor.rate != 0) {
+      _clockTimer = Timer.periodic(const Duration(milliseconds: 200), (_) {
+        value = value.copyWith(position: currentPosition);
+      });
+    }
+  }
+
   /// Initializes the player with the video source.
   ///
   /// This creates the native player, registers a texture for rendering,
@@ -242,10 +319,27 @@ class AVPlayerController extends ValueNotifier<AVPlayerState> {
         );
       case AVBufferingUpdateEvent(:final buffered):
         value = value.copyWith(buffered: buffered);
+      case AVStateUpdateEvent(:final buffered):
+        value = value.copyWith(buffered: buffered);
+      case AVClockAnchorEvent(:final position, :final rate, :final timestampUs):
+        _setClockAnchor(AVClockAnchorEvent(
+          position: position,
+          rate: rate,
+          timestampUs: _anchorTimeUs(timestampUs),
+        ));
       case AVPipChangedEvent(:final isInPipMode):
         value = value.copyWith(isInPipMode: isInPipMode);
       case AVCompletedEvent():
         value = value.copyWith(isPlaying: false, isCompleted: true);
+      case AVTrackChangedEvent(:final duration, :final width, :final height):
+        value = value.copyWith(
+          duration: duration,
+          position: Duration.zero,
+          buffered: Duration.zero,
+          isCompleted: false,
+          aspectRatio: width > 0 && height > 0 ? width / height : null,
+        );
+        onTrackChanged?.call();
       case AVErrorEvent(:final message):
         value = value.copyWith(errorDescription: message);
       case AVMediaCommandEvent(:final command, :final seekPosition):
@@ -307,14 +401,33 @@ class AVPlayerController extends ValueNotifier<AVPlayerState> {
   }
 
   /// Seeks to the given [position].
-  Future<void> seekTo(Duration position) async {
+  ///
+  /// Pass a keyframe [mode] for fast, approximate seeks (e.g. while the user
+  /// drags a seek bar) and [AVSeekMode.accurate] for the final position.
+  Future<void> seekTo(
+    Duration position, {
+    AVSeekMode mode = AVSeekMode.accurate,
+  }) async {
     final id = _playerId;
     if (id == null) return;
-    await _platform.seekTo(id, position);
+    await _platform.seekTo(id, position, mode: mode);
     value = value.copyWith(position: position, isCompleted: false);
+    final anchor = _clockAnchor;
+    if (anchor != null) {
+      // Until the platform anchors the landed seek.
+      _setClockAnchor(AVClockAnchorEvent(
+        position: position,
+        rate: anchor.rate,
+        timestampUs: monotonicMicros(),
+      ));
+    }
   }
 
   /// Sets the playback speed. 1.0 is normal speed.
+  ///
+  /// On Linux, negative speeds play in reverse, and above 4x in either
+  /// direction only keyframes are decoded with audio muted, which makes
+  /// 16x or 32x scanning affordable.
   Future<void> setPlaybackSpeed(double speed) async {
     final id = _playerId;
     if (id == null) return;
@@ -400,6 +513,121 @@ class AVPlayerController extends ValueNotifier<AVPlayerState> {
     return _platform.getDecoderInfo(id);
   }
 
+  /// Tells the native player the size the video is displayed at, in physical
+  /// pixels (logical size times device pixel ratio).
+  ///
+  /// Platforms that copy frames on the CPU (Linux, Windows) scale them to
+  /// this size before the copy instead of using the native resolution,
+  /// which makes small tiles in a grid or feed much cheaper. Frames are
+  /// never upscaled. Pass 0 for both to restore native resolution.
+  Future<void> setRenderSize(int width, int height) async {
+    final id = _playerId;
+    if (id == null) return;
+    await _platform.setRenderSize(id, width, height);
+  }
+
+  /// Switches the Linux player between GStreamer's generic `videoconvert`
+  /// and the plugin's SIMD YUV to RGBA converter, which writes I420, NV12
+  /// and P010 frames straight into the texture buffer. No-op elsewhere.
+  Future<void> setNativeColorConversion(bool enabled) async {
+    final id = _playerId;
+    if (id == null) return;
+    await _platform.setNativeColorConversion(id, enabled);
+  }
+
+  /// Caps the threads the Linux player uses to convert and scale frames.
+  ///
+  /// All players share a budget of one thread per core: explicit requests
+  /// are served first and players left at 0 (the default) split the rest.
+  /// No-op elsewhere.
+  Future<void> setConversionThreads(int threads) async {
+    final id = _playerId;
+    if (id == null) return;
+    await _platform.setConversionThreads(id, threads);
+  }
+
+  /// Frame counters and render-path latency percentiles for this player.
+  ///
+  /// Useful for telling a decode-bound player (frames presented fall
+  /// behind without drops) from a raster-bound one (drops grow). Returns
+  /// [AVRenderStats.empty] before [initialize].
+  Future<AVRenderStats> getRenderStats() async {
+    final id = _playerId;
+    if (id == null) return AVRenderStats.empty;
+    return _platform.getRenderStats(id);
+  }
+
+  /// Keyframe positions of the current source, ascending.
+  ///
+  /// Seeking to one of these is cheap in every [AVSeekMode]; a seek bar
+  /// can snap to them while scrubbing. The index is built in the
+  /// background on first use, so early calls may return a partial list.
+  /// Returns an empty list before [initialize] and on platforms that
+  /// cannot index the source.
+  Future<List<Duration>> getKeyframes() async {
+    final id = _playerId;
+    if (id == null) return const [];
+    return _platform.getKeyframes(id);
+  }
+
+  /// Queues [next] to start as soon as the current source ends, on the
+  /// same texture, without tearing the player down.
+  ///
+  /// When it starts, [value] is reset for the new source and
+  /// [onTrackChanged] is called; [source] keeps the source the controller
+  /// was created with. Returns `false` before [initialize] and on
+  /// platforms that cannot switch in place (currently all but Linux), in
+  /// which case the current source completes as usual.
+  Future<bool> queueNext(AVVideoSource next) async {
+    final id = _playerId;
+    if (id == null) return false;
+    return _platform.queueNext(id, next);
+  }
+
+  /// Switches this controller to [next] without creating a new player, so
+  /// the texture and event stream are kept and the switch is cheap.
+  ///
+  /// Playback stops and [value] is reset until the new source has loaded;
+  /// the player is then paused at its start. [source] keeps the source the
+  /// controller was created with. Returns `false` before [initialize] and on
+  /// platforms that cannot swap in place (currently all but Linux); create a
+  /// new controller there instead.
+  Future<bool> setSource(AVVideoSource next) async {
+    final id = _playerId;
+    if (id == null) return false;
+    final swapped = await _platform.setSource(id, next);
+    if (swapped) {
+      _setClockAnchor(null);
+      value = value.copyWith(
+        isInitialized: false,
+        isPlaying: false,
+        isBuffering: false,
+        isCompleted: false,
+        position: Duration.zero,
+        buffered: Duration.zero,
+      );
+    }
+    return swapped;
+  }
+
+  /// Starts loading [sources] so that controllers created for them later
+  /// initialize without waiting for the network or the decoder.
+  ///
+  /// Meant for feed-style UIs: preload the next few items while the
+  /// current one plays. The platform keeps a small pool of warm players
+  /// and drops the least recently preloaded ones when it is full or
+  /// memory runs low, so preloading more than the next few sources is
+  /// wasted work. Currently only Linux keeps a pool; elsewhere this does
+  /// nothing.
+  ///
+  /// Throws a `PlatformException` with code `MEMORY_PRESSURE`, skipping the
+  /// remaining [sources], when memory is too low to keep another player.
+  static Future<void> preload(List<AVVideoSource> sources) async {
+    for (final source in sources) {
+      await _platform.preload(source);
+    }
+  }
+
   // ===========================================================================
   // Subtitles
   // ===========================================================================
@@ -507,7 +735,7 @@ class AVPlayerController extends ValueNotifier<AVPlayerState> {
     final cues = _externalCues[trackId];
     if (cues == null) return;
 
-    final position = value.position;
+    final position = currentPosition;
     AVSubtitleCue? active;
     for (final cue in cues) {
       if (position >= cue.startTime && position < cue.endTime) {
@@ -529,6 +757,7 @@ class AVPlayerController extends ValueNotifier<AVPlayerState> {
   @override
   void dispose() {
     _subtitleSyncTimer?.cancel();
+    _clockTimer?.cancel();
     _eventSubscription?.cancel();
     final id = _playerId;
     if (id != null) {
@@ -115,6 +115,10 @@ class _AVControlsState extends State<AVControls>
   late final Animation<double> _fadeAnimation;
   bool _draggingSeekBar = false;
   double? _dragPosition;
+  // At most one drag seek is outstanding; updates arriving meanwhile only
+  // keep the newest target, which is issued when the seek returns.
+  bool _scrubSeeking = false;
+  Duration? _pendingScrub;
 
   AVControlsConfig get _config => widget.config;
 
@@ -430,10 +434,13 @@ class _AVControlsState extends State<AVControls>
         },
         onChanged: (value) {
           setState(() => _dragPosition = value);
+          _scrubTo(Duration(milliseconds: value.toInt()));
         },
         onChangeEnd: (value) {
           _draggingSeekBar = false;
           _dragPosition = null;
+          _pendingScrub = null;
+          // Land on the exact frame the thumb was released on.
           widget.controller.seekTo(Duration(milliseconds: value.toInt()));
           _startHideTimer();
         },
@@ -441,6 +448,25 @@ class _AVControlsState extends State<AVControls>
     );
   }
 
+  // Keyframe seeks keep the picture following the thumb cheaply. Not every
+  // platform coalesces seeks, so one per drag update would queue a flushing
+  // seek per pointer event.
+  void _scrubTo(Duration position) {
+    if (_scrubSeeking) {
+      _pendingScrub = position;
+      return;
+    }
+    _scrubSeeking = true;
+    widget.controller
+        .seekTo(position, mode: AVSeekMode.nearestKeyframe)
+        .whenComplete(() {
+      _scrubSeeking = false;
+      final next = _pendingScrub;
+      _pendingScrub = null;
+      if (next != null && _draggingSeekBar && mounted) _scrubTo(next);
+    });
+  }
+
   @override
   void dispose() {
     _hideTimer?.cancel();
@@ -59,7 +59,15 @@ abstract class AvPlayerPlatform extends PlatformInterface {
   }
 
   /// Seeks to the given [position].
-  Future<void> seekTo(int playerId, Duration position) {
+  ///
+  /// [mode] trades precision for speed: the keyframe modes land on a sync
+  /// sample near [position] and skip decoding up to it. Platforms without
+  /// keyframe seeking treat every mode as [AVSeekMode.accurate].
+  Future<void> seekTo(
+    int playerId,
+    Duration position, {
+    AVSeekMode mode = AVSeekMode.accurate,
+  }) {
     throw UnimplementedError('seekTo() has not been implemented.');
   }
 
@@ -169,6 +177,79 @@ abstract class AvPlayerPlatform extends PlatformInterface {
     throw UnimplementedError('selectSubtitleTrack() has not been implemented.');
   }
 
+  // ===========================================================================
+  // Rendering
+  // ===========================================================================
+
+  /// Limits decoded frames for [playerId] to [width] x [height] physical
+  /// pixels, the size the video is actually displayed at.
+  ///
+  /// Frames are downscaled (never upscaled) with their aspect ratio kept.
+  /// Pass 0 for both to restore native resolution.
+  Future<void> setRenderSize(int playerId, int width, int height) {
+    throw UnimplementedError('setRenderSize() has not been implemented.');
+  }
+
+  /// Enables the built-in SIMD YUV to RGBA converter for [playerId] in place
+  /// of the generic GStreamer `videoconvert` (Linux).
+  Future<void> setNativeColorConversion(int playerId, bool enabled) {
+    throw UnimplementedError(
+        'setNativeColorConversion() has not been implemented.');
+  }
+
+  /// Sets how many threads [playerId] may use for color conversion and
+  /// scaling (Linux). Pass 0 to take an even share of the cores left over
+  /// after other players' explicit requests.
+  Future<void> setConversionThreads(int playerId, int threads) {
+    throw UnimplementedError(
+        'setConversionThreads() has not been implemented.');
+  }
+
+  /// Returns frame counters and render-path latency percentiles for
+  /// [playerId]. Values a platform cannot measure are zero.
+  Future<AVRenderStats> getRenderStats(int playerId) {
+    throw UnimplementedError('getRenderStats() has not been implemented.');
+  }
+
+  /// Returns the keyframe positions of [playerId]'s source, ascending.
+  ///
+  /// Indexing runs in the background and starts on the first call, so
+  /// early calls may return a partial list. Platforms that cannot index
+  /// the source return an empty list.
+  Future<List<Duration>> getKeyframes(int playerId) {
+    throw UnimplementedError('getKeyframes() has not been implemented.');
+  }
+
+  /// Queues [source] to play on [playerId] right after the current one,
+  /// on the same texture and event stream, with no gap between them.
+  ///
+  /// The switch is reported with an [AVTrackChangedEvent]. A later call
+  /// replaces the queued source. Returns `false` if the platform cannot
+  /// switch sources in place; callers then create a new player when the
+  /// current one completes.
+  Future<bool> queueNext(int playerId, AVVideoSource source) {
+    throw UnimplementedError('queueNext() has not been implemented.');
+  }
+
+  /// Starts loading [source] in the background so a later [create] for
+  /// the same source returns an already prerolled player.
+  ///
+  /// Preloaded players are kept in a small pool and evicted least
+  /// recently used first. Platforms without a pool ignore the call.
+  Future<void> preload(AVVideoSource source) {
+    throw UnimplementedError('preload() has not been implemented.');
+  }
+
+  /// Replaces the source of [playerId] in place, keeping its texture and
+  /// event stream.
+  ///
+  /// The player stops, loads [source] and sends a new [AVInitializedEvent]
+  /// once it has prerolled; it is left paused. Returns `false` if the
+  /// platform cannot swap sources, in which case nothing changes.
+  Future<bool> setSource(int playerId, AVVideoSource source) {
+    throw UnimplementedError('setSource() has not been implemented.');
+  }
+
   // ===========================================================================
   // Events
   // ===========================================================================
@@ -1,5 +1,6 @@
 import 'dart:async';
 import 'dart:js_interop';
+import 'dart:js_interop_unsafe';
 import 'dart:ui_web' as ui_web;
 
 import 'package:web/web.dart' as web;
@@ -75,10 +76,21 @@ class AvPlayerWeb extends AvPlayerPlatform {
   }
 
   @override
-  Future<void> seekTo(int playerId, Duration position) async {
+  Future<void> seekTo(
+    int playerId,
+    Duration position, {
+    AVSeekMode mode = AVSeekMode.accurate,
+  }) async {
     final player = _players[playerId];
     if (player == null) return;
-    player.videoElement.currentTime = position.inMilliseconds / 1000.0;
+    final seconds = position.inMilliseconds / 1000.0;
+    // fastSeek() lands on a nearby keyframe; Chromium does not implement it.
+    if (mode != AVSeekMode.accurate &&
+        (player.videoElement as JSObject).has('fastSeek')) {
+      player.videoElement.fastSeek(seconds);
+    } else {
+      player.videoElement.currentTime = seconds;
+    }
   }
 
   @override
@@ -265,6 +277,60 @@ class AvPlayerWeb extends AvPlayerPlatform {
     }
   }
 
+  // ===========================================================================
+  // Rendering
+  // ===========================================================================
+
+  @override
+  Future<void> setRenderSize(int playerId, int width, int height) async {
+    // The browser scales the <video> element itself.
+  }
+
+  @override
+  Future<void> setNativeColorConversion(int playerId, bool enabled) async {
+    // The browser converts decoded frames itself.
+  }
+
+  @override
+  Future<void> setConversionThreads(int playerId, int threads) async {
+    // The browser schedules decoding and conversion itself.
+  }
+
+  @override
+  Future<AVRenderStats> getRenderStats(int playerId) async {
+    final player = _players[playerId];
+    if (player == null) return AVRenderStats.empty;
+    final quality = player.videoElement.getVideoPlaybackQuality();
+    return AVRenderStats(
+      framesDecoded: quality.totalVideoFrames,
+      framesPresented: quality.totalVideoFrames - quality.droppedVideoFrames,
+      framesDropped: quality.droppedVideoFrames,
+    );
+  }
+
+  @override
+  Future<List<Duration>> getKeyframes(int playerId) async {
+    // Media elements do not expose keyframe positions.
+    return const [];
+  }
+
+  @override
+  Future<bool> queueNext(int playerId, AVVideoSource source) async {
+    // A media element plays one source; switching reloads it.
+    return false;
+  }
+
+  @override
+  Future<void> preload(AVVideoSource source) async {
+    // The browser caches media itself.
+  }
+
+  @override
+  Future<bool> setSource(int playerId, AVVideoSource source) async {
+    // Not supported yet; callers create a new player.
+    return false;
+  }
+
   // ===========================================================================
   // Events
   // ===========================================================================
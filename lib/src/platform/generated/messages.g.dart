@@ -32,6 +32,13 @@ enum SourceType {
   file,
 }
 
+enum SeekMode {
+  accurate,
+  keyframeBefore,
+  keyframeAfter,
+  nearestKeyframe,
+}
+
 class VideoSourceMessage {
   VideoSourceMessage({
     required this.type,
@@ -311,6 +318,185 @@ class SelectSubtitleTrackRequest {
   }
 }
 
+class RenderStatsMessage {
+  RenderStatsMessage({
+    required this.framesDecoded,
+    required this.framesPresented,
+    required this.framesDropped,
+    required this.conversionP50Us,
+    required this.conversionP95Us,
+    required this.conversionP99Us,
+    required this.copyP50Us,
+    required this.copyP95Us,
+    required this.copyP99Us,
+    required this.latenessP50Us,
+    required this.latenessP95Us,
+    required this.latenessP99Us,
+    required this.audioFilterP50Us,
+    required this.audioFilterP95Us,
+    required this.audioFilterP99Us,
+  });
+
+  int framesDecoded;
+
+  int framesPresented;
+
+  int framesDropped;
+
+  int conversionP50Us;
+
+  int conversionP95Us;
+
+  int conversionP99Us;
+
+  int copyP50Us;
+
+  int copyP95Us;
+
+  int copyP99Us;
+
+  int latenessP50Us;
+
+  int latenessP95Us;
+
+  int latenessP99Us;
+
+  int audioFilterP50Us;
+
+  int audioFilterP95Us;
+
+  int audioFilterP99Us;
+
+  Object encode() {
+    return <Object?>[
+      framesDecoded,
+      framesPresented,
+      framesDropped,
+      conversionP50Us,
+      conversionP95Us,
+      conversionP99Us,
+      copyP50Us,
+      copyP95Us,
+      copyP99Us,
+      latenessP50Us,
+      latenessP95Us,
+      latenessP99Us,
+      audioFilterP50Us,
+      audioFilterP95Us,
+      audioFilterP99Us,
+    ];
+  }
+
+  static RenderStatsMessage decode(Object result) {
+    result as List<Object?>;
+    return RenderStatsMessage(
+      framesDecoded: result[0]! as int,
+      framesPresented: result[1]! as int,
+      framesDropped: result[2]! as int,
+      conversionP50Us: result[3]! as int,
+      conversionP95Us: result[4]! as int,
+      conversionP99Us: result[5]! as int,
+      copyP50Us: result[6]! as int,
+      copyP95Us: result[7]! as int,
+      copyP99Us: result[8]! as int,
+      latenessP50Us: result[9]! as int,
+      latenessP95Us: result[10]! as int,
+      latenessP99Us: result[11]! as int,
+      audioFilterP50Us: result[12]! as int,
+      audioFilterP95Us: result[13]! as int,
+      audioFilterP99Us: result[14]! as int,
+    );
+  }
+}
+
+class CreateResultMessage {
+  CreateResultMessage({
+    required this.playerId,
+    required this.createLatencyUs,
+  });
+
+  int playerId;
+
+  int createLatencyUs;
+
+  Object encode() {
+    return <Object?>[
+      playerId,
+      createLatencyUs,
+    ];
+  }
+
+  static CreateResultMessage decode(Object result) {
+    result as List<Object?>;
+    return CreateResultMessage(
+      playerId: result[0]! as int,
+      createLatencyUs: result[1]! as int,
+    );
+  }
+}
+
+class ClockAnchorMessage {
+  ClockAnchorMessage({
+    required this.playerId,
+    required this.positionMs,
+    required this.rate,
+    required this.timestampUs,
+  });
+
+  int playerId;
+
+  int positionMs;
+
+  double rate;
+
+  int timestampUs;
+
+  Object encode() {
+    return <Object?>[
+      playerId,
+      positionMs,
+      rate,
+      timestampUs,
+    ];
+  }
+
+  static ClockAnchorMessage decode(Object result) {
+    result as List<Object?>;
+    return ClockAnchorMessage(
+      playerId: result[0]! as int,
+      positionMs: result[1]! as int,
+      rate: result[2]! as double,
+      timestampUs: result[3]! as int,
+    );
+  }
+}
+
+class StateUpdateMessage {
+  StateUpdateMessage({
+    required this.playerId,
+    required this.bufferedMs,
+  });
+
+  int playerId;
+
+  int bufferedMs;
+
+  Object encode() {
+    return <Object?>[
+      playerId,
+      bufferedMs,
+    ];
+  }
+
+  static StateUpdateMessage decode(Object result) {
+    result as List<Object?>;
+    return StateUpdateMessage(
+      playerId: result[0]! as int,
+      bufferedMs: result[1]! as int,
+    );
+  }
+}
+
 class _PigeonCodec extends StandardMessageCodec {
   const _PigeonCodec();
   @override
@@ -321,32 +507,47 @@ class _PigeonCodec extends StandardMessageCodec {
     } else if (value is SourceType) {
       buffer.putUint8(129);
       writeValue(buffer, value.index);
-    } else if (value is VideoSourceMessage) {
+    } else if (value is SeekMode) {
       buffer.putUint8(130);
+      writeValue(buffer, value.index);
+    } else if (value is VideoSourceMessage) {
+      buffer.putUint8(131);
       writeValue(buffer, value.encode());
     } else if (value is MediaMetadataMessage) {
-      buffer.putUint8(131);
+      buffer.putUint8(132);
       writeValue(buffer, value.encode());
     } else if (value is EnterPipRequest) {
-      buffer.putUint8(132);
+      buffer.putUint8(133);
       writeValue(buffer, value.encode());
     } else if (value is MediaMetadataRequest) {
-      buffer.putUint8(133);
+      buffer.putUint8(134);
       writeValue(buffer, value.encode());
     } else if (value is AbrConfigMessage) {
-      buffer.putUint8(134);
+      buffer.putUint8(135);
       writeValue(buffer, value.encode());
     } else if (value is SetAbrConfigRequest) {
-      buffer.putUint8(135);
+      buffer.putUint8(136);
       writeValue(buffer, value.encode());
     } else if (value is DecoderInfoMessage) {
-      buffer.putUint8(136);
+      buffer.putUint8(137);
       writeValue(buffer, value.encode());
     } else if (value is SubtitleTrackMessage) {
-      buffer.putUint8(137);
+      buffer.putUint8(138);
       writeValue(buffer, value.encode());
     } else if (value is SelectSubtitleTrackRequest) {
-      buffer.putUint8(138);
+      buffer.putUint8(139);
+      writeValue(buffer, value.encode());
+    } else if (value is RenderStatsMessage) {
+      buffer.putUint8(140);
+      writeValue(buffer, value.encode());
+    } else if (value is CreateResultMessage) {
+      buffer.putUint8(141);
+      writeValue(buffer, value.encode());
+    } else if (value is ClockAnchorMessage) {
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
+    } else if (value is StateUpdateMessage) {
+      buffer.putUint8(143);
       writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
@@ -360,23 +561,34 @@ class _PigeonCodec extends StandardMessageCodec {
         final int? value = readValue(buffer) as int?;
         return value == null ? null : SourceType.values[value];
       case 130:
-        return VideoSourceMessage.decode(readValue(buffer)!);
+        final int? value = readValue(buffer) as int?;
+        return value == null ? null : SeekMode.values[value];
       case 131:
-        return MediaMetadataMessage.decode(readValue(buffer)!);
+        return VideoSourceMessage.decode(readValue(buffer)!);
       case 132:
-        return EnterPipRequest.decode(readValue(buffer)!);
+        return MediaMetadataMessage.decode(readValue(buffer)!);
       case 133:
-        return MediaMetadataRequest.decode(readValue(buffer)!);
+        return EnterPipRequest.decode(readValue(buffer)!);
       case 134:
-        return AbrConfigMessage.decode(readValue(buffer)!);
+        return MediaMetadataRequest.decode(readValue(buffer)!);
       case 135:
-        return SetAbrConfigRequest.decode(readValue(buffer)!);
+        return AbrConfigMessage.decode(readValue(buffer)!);
       case 136:
-        return DecoderInfoMessage.decode(readValue(buffer)!);
+        return SetAbrConfigRequest.decode(readValue(buffer)!);
       case 137:
-        return SubtitleTrackMessage.decode(readValue(buffer)!);
+        return DecoderInfoMessage.decode(readValue(buffer)!);
       case 138:
+        return SubtitleTrackMessage.decode(readValue(buffer)!);
+      case 139:
         return SelectSubtitleTrackRequest.decode(readValue(buffer)!);
+      case 140:
+        return RenderStatsMessage.decode(readValue(buffer)!);
+      case 141:
+        return CreateResultMessage.decode(readValue(buffer)!);
+      case 142:
+        return ClockAnchorMessage.decode(readValue(buffer)!);
+      case 143:
+        return StateUpdateMessage.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
@@ -398,7 +610,7 @@ class AvPlayerHostApi {
 
   final String pigeonVar_messageChannelSuffix;
 
-  Future<int> create(VideoSourceMessage source) async {
+  Future<CreateResultMessage> create(VideoSourceMessage source) async {
     final String pigeonVar_channelName =
         'dev.flutter.pigeon.av_player.AvPlayerHostApi.create$pigeonVar_messageChannelSuffix';
     final BasicMessageChannel<Object?> pigeonVar_channel =
@@ -423,7 +635,7 @@ class AvPlayerHostApi {
         message: 'Host platform returned null value for non-null return value.',
       );
     } else {
-      return (pigeonVar_replyList[0] as int?)!;
+      return (pigeonVar_replyList[0] as CreateResultMessage?)!;
     }
   }
 
@@ -499,7 +711,7 @@ class AvPlayerHostApi {
     }
   }
 
-  Future<void> seekTo(int playerId, int positionMs) async {
+  Future<void> seekTo(int playerId, int positionMs, SeekMode mode) async {
     final String pigeonVar_channelName =
         'dev.flutter.pigeon.av_player.AvPlayerHostApi.seekTo$pigeonVar_messageChannelSuffix';
     final BasicMessageChannel<Object?> pigeonVar_channel =
@@ -509,7 +721,7 @@ class AvPlayerHostApi {
       binaryMessenger: pigeonVar_binaryMessenger,
     );
     final List<Object?>? pigeonVar_replyList = await pigeonVar_channel
-        .send(<Object?>[playerId, positionMs]) as List<Object?>?;
+        .send(<Object?>[playerId, positionMs, mode]) as List<Object?>?;
     if (pigeonVar_replyList == null) {
       throw _createConnectionError(pigeonVar_channelName);
     } else if (pigeonVar_replyList.length > 1) {
@@ -956,4 +1168,293 @@ class AvPlayerHostApi {
       return;
     }
   }
+
+  Future<void> setRenderSize(int playerId, int width, int height) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.setRenderSize$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList = await pigeonVar_channel
+        .send(<Object?>[playerId, width, height]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setNativeColorConversion(int playerId, bool enabled) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.setNativeColorConversion$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList = await pigeonVar_channel
+        .send(<Object?>[playerId, enabled]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setConversionThreads(int playerId, int threads) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.setConversionThreads$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList = await pigeonVar_channel
+        .send(<Object?>[playerId, threads]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<RenderStatsMessage> getRenderStats(int playerId) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.getRenderStats$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[playerId]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as RenderStatsMessage?)!;
+    }
+  }
+
+  Future<List<int>> getKeyframes(int playerId) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.getKeyframes$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[playerId]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as List<Object?>?)!.cast<int>();
+    }
+  }
+
+  Future<bool> queueNext(int playerId, VideoSourceMessage source) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.queueNext$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList = await pigeonVar_channel
+        .send(<Object?>[playerId, source]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as bool?)!;
+    }
+  }
+
+  Future<void> preload(VideoSourceMessage source) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.preload$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[source]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<bool> setSource(int playerId, VideoSourceMessage source) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.av_player.AvPlayerHostApi.setSource$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList = await pigeonVar_channel
+        .send(<Object?>[playerId, source]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as bool?)!;
+    }
+  }
+}
+
+abstract class AvPlayerEventApi {
+  static const MessageCodec<Object?> pigeonChannelCodec = _PigeonCodec();
+
+  void onClockAnchor(ClockAnchorMessage anchor);
+
+  void onStateUpdate(StateUpdateMessage update);
+
+  static void setUp(
+    AvPlayerEventApi? api, {
+    BinaryMessenger? binaryMessenger,
+    String messageChannelSuffix = '',
+  }) {
+    messageChannelSuffix =
+        messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
+    {
+      final BasicMessageChannel<
+          Object?> pigeonVar_channel = BasicMessageChannel<
+              Object?>(
+          'dev.flutter.pigeon.av_player.AvPlayerEventApi.onClockAnchor$messageChannelSuffix',
+          pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.av_player.AvPlayerEventApi.onClockAnchor was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final ClockAnchorMessage? arg_anchor =
+              (args[0] as ClockAnchorMessage?);
+          assert(arg_anchor != null,
+              'Argument for dev.flutter.pigeon.av_player.AvPlayerEventApi.onClockAnchor was null, expected non-null ClockAnchorMessage.');
+          try {
+            api.onClockAnchor(arg_anchor!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<
+          Object?> pigeonVar_channel = BasicMessageChannel<
+              Object?>(
+          'dev.flutter.pigeon.av_player.AvPlayerEventApi.onStateUpdate$messageChannelSuffix',
+          pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.av_player.AvPlayerEventApi.onStateUpdate was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final StateUpdateMessage? arg_update =
+              (args[0] as StateUpdateMessage?);
+          assert(arg_update != null,
+              'Argument for dev.flutter.pigeon.av_player.AvPlayerEventApi.onStateUpdate was null, expected non-null StateUpdateMessage.');
+          try {
+            api.onStateUpdate(arg_update!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
 }
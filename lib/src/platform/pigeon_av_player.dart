@@ -1,3 +1,5 @@
+import 'dart:async';
+
 import 'package:flutter/services.dart';
 
 import 'av_player_platform.dart';
@@ -8,7 +10,9 @@ import 'generated/messages.g.dart';
 /// provide the [eventChannelPrefix] used for EventChannel names.
 ///
 /// EventChannel is kept manual because Pigeon does not generate
-/// EventChannel code.
+/// EventChannel code. Platforms that send the periodic clock and state
+/// events as typed [AvPlayerEventApi] messages have them merged into the
+/// same [playerEvents] stream.
 class PigeonAvPlayer extends AvPlayerPlatform {
   PigeonAvPlayer({required String eventChannelPrefix})
       : _eventChannelPrefix = eventChannelPrefix;
@@ -16,17 +20,30 @@ class PigeonAvPlayer extends AvPlayerPlatform {
   final AvPlayerHostApi _api = AvPlayerHostApi();
   final String _eventChannelPrefix;
 
+  // Create latency reported by the platform, kept for getRenderStats.
+  final Map<int, Duration> _createLatencies = {};
+
+  // Per-player event streams, fed by the player's EventChannel while
+  // listened to and by AvPlayerEventApi messages.
+  final Map<int, StreamController<AVPlayerEvent>> _events = {};
+  bool _eventApiSetUp = false;
+
   // ===========================================================================
   // Lifecycle
   // ===========================================================================
 
   @override
-  Future<int> create(AVVideoSource source) {
-    return _api.create(_videoSourceToMessage(source));
+  Future<int> create(AVVideoSource source) async {
+    final result = await _api.create(_videoSourceToMessage(source));
+    _createLatencies[result.playerId] =
+        Duration(microseconds: result.createLatencyUs);
+    return result.playerId;
   }
 
   @override
   Future<void> dispose(int playerId) {
+    _createLatencies.remove(playerId);
+    _events.remove(playerId)?.close();
     return _api.dispose(playerId);
   }
 
@@ -41,8 +58,16 @@ class PigeonAvPlayer extends AvPlayerPlatform {
   Future<void> pause(int playerId) => _api.pause(playerId);
 
   @override
-  Future<void> seekTo(int playerId, Duration position) {
-    return _api.seekTo(playerId, position.inMilliseconds);
+  Future<void> seekTo(
+    int playerId,
+    Duration position, {
+    AVSeekMode mode = AVSeekMode.accurate,
+  }) {
+    return _api.seekTo(
+      playerId,
+      position.inMilliseconds,
+      _seekModeToMessage(mode),
+    );
   }
 
   @override
@@ -173,15 +198,110 @@ class PigeonAvPlayer extends AvPlayerPlatform {
     ));
   }
 
+  // ===========================================================================
+  // Rendering
+  // ===========================================================================
+
+  @override
+  Future<void> setRenderSize(int playerId, int width, int height) {
+    return _api.setRenderSize(playerId, width, height);
+  }
+
+  @override
+  Future<void> setNativeColorConversion(int playerId, bool enabled) {
+    return _api.setNativeColorConversion(playerId, enabled);
+  }
+
+  @override
+  Future<void> setConversionThreads(int playerId, int threads) {
+    return _api.setConversionThreads(playerId, threads);
+  }
+
+  @override
+  Future<AVRenderStats> getRenderStats(int playerId) async {
+    final msg = await _api.getRenderStats(playerId);
+    return AVRenderStats(
+      framesDecoded: msg.framesDecoded,
+      framesPresented: msg.framesPresented,
+      framesDropped: msg.framesDropped,
+      conversion: AVLatencyPercentiles(
+        p50: Duration(microseconds: msg.conversionP50Us),
+        p95: Duration(microseconds: msg.conversionP95Us),
+        p99: Duration(microseconds: msg.conversionP99Us),
+      ),
+      copy: AVLatencyPercentiles(
+        p50: Duration(microseconds: msg.copyP50Us),
+        p95: Duration(microseconds: msg.copyP95Us),
+        p99: Duration(microseconds: msg.copyP99Us),
+      ),
+      lateness: AVLatencyPercentiles(
+        p50: Duration(microseconds: msg.latenessP50Us),
+        p95: Duration(microseconds: msg.latenessP95Us),
+        p99: Duration(microseconds: msg.latenessP99Us),
+      ),
+      audioFilter: AVLatencyPercentiles(
+        p50: Duration(microseconds: msg.audioFilterP50Us),
+        p95: Duration(microseconds: msg.audioFilterP95Us),
+        p99: Duration(microseconds: msg.audioFilterP99Us),
+      ),
+      createLatency: _createLatencies[playerId] ?? Duration.zero,
+    );
+  }
+
+  @override
+  Future<List<Duration>> getKeyframes(int playerId) async {
+    final positions = await _api.getKeyframes(playerId);
+    return positions.map((ms) => Duration(milliseconds: ms)).toList();
+  }
+
+  @override
+  Future<bool> queueNext(int playerId, AVVideoSource source) {
+    return _api.queueNext(playerId, _videoSourceToMessage(source));
+  }
+
+  @override
+  Future<void> preload(AVVideoSource source) {
+    return _api.preload(_videoSourceToMessage(source));
+  }
+
+  @override
+  Future<bool> setSource(int playerId, AVVideoSource source) {
+    return _api.setSource(playerId, _videoSourceToMessage(source));
+  }
+
   // ===========================================================================
   // Events (manual EventChannel — Pigeon doesn't generate these)
   // ===========================================================================
 
   @override
   Stream<AVPlayerEvent> playerEvents(int playerId) {
-    return EventChannel('$_eventChannelPrefix/events/$playerId')
-        .receiveBroadcastStream()
-        .map((event) => AVPlayerEvent.fromMap(event as Map<dynamic, dynamic>));
+    if (!_eventApiSetUp) {
+      AvPlayerEventApi.setUp(_EventApiHandler(_addTypedEvent));
+      _eventApiSetUp = true;
+    }
+    return _events.putIfAbsent(playerId, () {
+      StreamSubscription<dynamic>? channelSubscription;
+      late final StreamController<AVPlayerEvent> controller;
+      controller = StreamController<AVPlayerEvent>.broadcast(
+        onListen: () {
+          channelSubscription =
+              EventChannel('$_eventChannelPrefix/events/$playerId')
+                  .receiveBroadcastStream()
+                  .listen(
+                    (event) => controller.add(
+                        AVPlayerEvent.fromMap(event as Map<dynamic, dynamic>)),
+                    onError: controller.addError,
+                  );
+        },
+        onCancel: () => channelSubscription?.cancel(),
+      );
+      return controller;
+    }).stream;
+  }
+
+  void _addTypedEvent(int playerId, AVPlayerEvent event) {
+    final controller = _events[playerId];
+    if (controller != null && controller.hasListener) controller.add(event);
   }
 
   // ===========================================================================
@@ -205,4 +325,40 @@ class PigeonAvPlayer extends AvPlayerPlatform {
         ),
     };
   }
+
+  static SeekMode _seekModeToMessage(AVSeekMode mode) {
+    return switch (mode) {
+      AVSeekMode.accurate => SeekMode.accurate,
+      AVSeekMode.keyframeBefore => SeekMode.keyframeBefore,
+      AVSeekMode.keyframeAfter => SeekMode.keyframeAfter,
+      AVSeekMode.nearestKeyframe => SeekMode.nearestKeyframe,
+    };
+  }
+}
+
+/// Routes [AvPlayerEventApi] messages to [PigeonAvPlayer.playerEvents].
+class _EventApiHandler implements AvPlayerEventApi {
+  _EventApiHandler(this._add);
+
+  final void Function(int playerId, AVPlayerEvent event) _add;
+
+  @override
+  void onClockAnchor(ClockAnchorMessage anchor) {
+    _add(
+      anchor.playerId,
+      AVClockAnchorEvent(
+        position: Duration(milliseconds: anchor.positionMs),
+        rate: anchor.rate,
+        timestampUs: anchor.timestampUs,
+      ),
+    );
+  }
+
+  @override
+  void onStateUpdate(StateUpdateMessage update) {
+    _add(
+      update.playerId,
+      AVStateUpdateEvent(buffered: Duration(milliseconds: update.bufferedMs)),
+    );
+  }
 }
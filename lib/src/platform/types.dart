@@ -142,6 +142,101 @@ class AVDecoderInfo {
   static const unknown = AVDecoderInfo(isHardwareAccelerated: false);
 }
 
+// ---------------------------------------------------------------------------
+// Render stats
+// ---------------------------------------------------------------------------
+
+/// The 50th, 95th and 99th percentile of a per-frame timing.
+@immutable
+class AVLatencyPercentiles {
+  const AVLatencyPercentiles({
+    this.p50 = Duration.zero,
+    this.p95 = Duration.zero,
+    this.p99 = Duration.zero,
+  });
+
+  final Duration p50;
+  final Duration p95;
+  final Duration p99;
+
+  static const zero = AVLatencyPercentiles();
+}
+
+/// Frame accounting and render-path timings for a player since it was
+/// created.
+///
+/// A growing [framesDropped] count means frames are decoded faster than the
+/// app displays them (raster-bound); [framesPresented] falling behind the
+/// frame rate without drops points at the decoder. Platforms report what
+/// they can measure and leave the rest at zero.
+@immutable
+class AVRenderStats {
+  const AVRenderStats({
+    this.framesDecoded = 0,
+    this.framesPresented = 0,
+    this.framesDropped = 0,
+    this.conversion = AVLatencyPercentiles.zero,
+    this.copy = AVLatencyPercentiles.zero,
+    this.lateness = AVLatencyPercentiles.zero,
+    this.audioFilter = AVLatencyPercentiles.zero,
+    this.createLatency = Duration.zero,
+  });
+
+  /// Frames that came out of the decoder.
+  final int framesDecoded;
+
+  /// Frames that were handed to the screen.
+  final int framesPresented;
+
+  /// Decoded frames that were skipped or replaced before being shown.
+  final int framesDropped;
+
+  /// Time spent converting a frame to RGBA.
+  final AVLatencyPercentiles conversion;
+
+  /// Time spent copying (or attaching) an RGBA frame into the texture.
+  final AVLatencyPercentiles copy;
+
+  /// How far the playback clock had run past a frame's timestamp when it
+  /// became available to the engine.
+  final AVLatencyPercentiles lateness;
+
+  /// CPU time the pitch-keeping time-stretch filter spends on each audio
+  /// buffer. Zero where playback speed changes do not go through one.
+  final AVLatencyPercentiles audioFilter;
+
+  /// How long the platform took to create the player and answer `create`.
+  /// On Linux the pipeline is built off the platform thread, so this is the
+  /// wait `initialize()` saw rather than time spent on the UI thread.
+  final Duration createLatency;
+
+  /// Default value for platforms that do not collect render stats.
+  static const empty = AVRenderStats();
+}
+
+// ---------------------------------------------------------------------------
+// Seeking
+// ---------------------------------------------------------------------------
+
+/// Where a seek lands relative to the requested position.
+///
+/// Accurate seeks decode from the preceding keyframe up to the exact
+/// position, which is slow on long-GOP content. The keyframe modes stop at a
+/// sync sample instead and are the cheap choice while scrubbing.
+enum AVSeekMode {
+  /// Exactly the requested position.
+  accurate,
+
+  /// The last keyframe at or before the requested position.
+  keyframeBefore,
+
+  /// The first keyframe at or after the requested position.
+  keyframeAfter,
+
+  /// Whichever keyframe is closest to the requested position.
+  nearestKeyframe,
+}
+
 // ---------------------------------------------------------------------------
 // Memory pressure
 // ---------------------------------------------------------------------------
@@ -216,10 +311,23 @@ sealed class AVPlayerEvent {
       'bufferingUpdate' => AVBufferingUpdateEvent(
           buffered: Duration(milliseconds: map['buffered'] as int),
         ),
+      'clockAnchor' => AVClockAnchorEvent(
+          position: Duration(milliseconds: map['position'] as int),
+          rate: (map['rate'] as num).toDouble(),
+          timestampUs: map['timestamp'] as int,
+        ),
+      'stateUpdate' => AVStateUpdateEvent(
+          buffered: Duration(milliseconds: map['buffered'] as int),
+        ),
       'pipChanged' => AVPipChangedEvent(
           isInPipMode: map['isInPipMode'] as bool,
         ),
       'completed' => const AVCompletedEvent(),
+      'trackChanged' => AVTrackChangedEvent(
+          duration: Duration(milliseconds: map['duration'] as int? ?? 0),
+          width: (map['width'] as num?)?.toDouble() ?? 0,
+          height: (map['height'] as num?)?.toDouble() ?? 0,
+        ),
       'error' => AVErrorEvent(
           message: map['message'] as String? ?? 'Unknown error',
           code: map['code'] as String?,
@@ -303,6 +411,40 @@ class AVBufferingUpdateEvent extends AVPlayerEvent {
   final Duration buffered;
 }
 
+/// Buffered end, sent by Linux only when it changed. Linux sends this in
+/// place of [AVBufferingUpdateEvent] and reports the position through
+/// [AVClockAnchorEvent] instead of [AVPositionChangedEvent].
+class AVStateUpdateEvent extends AVPlayerEvent {
+  const AVStateUpdateEvent({required this.buffered});
+  final Duration buffered;
+}
+
+/// Playback clock anchor: the position was [position] at [timestampUs] on
+/// the platform's monotonic clock and advances at [rate] until the next
+/// anchor. Sent only on discontinuities (play, pause, seeks, rate and track
+/// changes, stalls), so the position can be extrapolated every frame without
+/// polling. Currently sent by Linux only. `AVPlayerController` re-stamps
+/// each anchor onto its own clock, since Dart cannot read the platform's
+/// clock in every build mode; an anchor delivered slower than the fastest
+/// one so far is dated back by the difference.
+class AVClockAnchorEvent extends AVPlayerEvent {
+  const AVClockAnchorEvent({
+    required this.position,
+    required this.rate,
+    required this.timestampUs,
+  });
+  final Duration position;
+  final double rate;
+  final int timestampUs;
+
+  /// The position at [nowUs] on the same clock, never negative.
+  Duration positionAt(int nowUs) {
+    final elapsedUs = ((nowUs - timestampUs) * rate).round();
+    final us = position.inMicroseconds + elapsedUs;
+    return Duration(microseconds: us > 0 ? us : 0);
+  }
+}
+
 /// PIP mode entered or exited.
 class AVPipChangedEvent extends AVPlayerEvent {
   const AVPipChangedEvent({required this.isInPipMode});
@@ -314,6 +456,21 @@ class AVCompletedEvent extends AVPlayerEvent {
   const AVCompletedEvent();
 }
 
+/// A source queued with `queueNext` started playing in place of the one
+/// that ended. Width and height are 0 when the new video size is not known
+/// yet.
+class AVTrackChangedEvent extends AVPlayerEvent {
+  const AVTrackChangedEvent({
+    required this.duration,
+    required this.width,
+    required this.height,
+  });
+
+  final Duration duration;
+  final double width;
+  final double height;
+}
+
 /// An error occurred.
 class AVErrorEvent extends AVPlayerEvent {
   const AVErrorEvent({required this.message, this.code});
@@ -4,17 +4,56 @@
 #include <gst/gst.h>
 #include <gtk/gtk.h>
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <list>
 #include <map>
 #include <string>
+#include <vector>
 
+#include "control_thread.h"
+#include "frame_buffer_pool.h"
 #include "messages.g.h"
 #include "player_instance.h"
 #include "system_controls.h"
 
 static const char kEventChannelPrefix[] = "com.flutterplaza.av_player_linux/events/";
 
+// Limits of the preload pool. A prerolled 1080p player holds about 25 MiB
+// of frames, so the byte cap is what usually applies.
+static const size_t kPoolMaxPlayers = 6;
+static const size_t kPoolMaxBytes = 256 * 1024 * 1024;
+// Tighter limits while memory runs low ("warning"); preloads still succeed.
+static const size_t kPoolLowMemoryMaxPlayers = 2;
+static const size_t kPoolLowMemoryMaxBytes = 64 * 1024 * 1024;
+
+// A player prerolled by preload() and not yet claimed by create().
+struct PooledPlayer {
+  std::string uri;
+  PlayerInstance* player;
+};
+
+// Periodic work of all players, batched into one control-thread wakeup.
+static const guint kTickIntervalMs = 200;
+static const gint64 kMemoryCheckIntervalUs = 5 * G_USEC_PER_SEC;
+// Memory check while the plugin holds players, for when none plays and the
+// tick is stopped.
+static const guint kIdleMemoryCheckIntervalS = 30;
+
+// Control thread, apart from creation and teardown.
+struct TickScheduler {
+  // nullptr once the plugin is being disposed.
+  FlAvPlayerPlugin* plugin;
+  // Players reported playing by their playing callbacks.
+  std::vector<PlayerInstance*> playing;
+  // Runs only while |playing| is not empty.
+  GSource* source;
+  gint64 last_memory_check_us;
+  // Level seen by the last check, to post only changes and pressure.
+  const char* last_memory_level;
+};
+
 // =============================================================================
 // Plugin struct
 // =============================================================================
@@ -24,8 +63,24 @@ struct _FlAvPlayerPlugin {
 
   FlPluginRegistrar* registrar;
 
+  // Typed channel for the periodic player events, shared by all players.
+  AvPlayerAvPlayerEventApi* event_api;
+
   // Player instances keyed by texture ID.
   std::map<int64_t, PlayerInstance*>* players;
+
+  // Conversion thread counts requested via setConversionThreads, keyed by
+  // texture ID. Players without an entry share what the requests leave.
+  std::map<int64_t, guint>* thread_requests;
+
+  // Preloaded players, most recently preloaded first.
+  std::list<PooledPlayer>* pool;
+  // Last memory pressure level read, nullptr while memory is fine.
+  const char* memory_level;
+  // Runs while |players| or |pool| is not empty; 0 otherwise.
+  guint idle_memory_check_id;
+
+  TickScheduler* scheduler;
 };
 
 G_DEFINE_TYPE(FlAvPlayerPlugin, fl_av_player_plugin,
@@ -44,6 +99,40 @@ static PlayerInstance* find_player_by_id(FlAvPlayerPlugin* self,
   return it->second;
 }
 
+// =============================================================================
+// Conversion thread budget
+// =============================================================================
+
+// Splits the cores between players, explicit requests first. Returns the
+// share of the others; |extra_players| are about to be created.
+static guint compute_thread_shares(FlAvPlayerPlugin* self,
+                                   guint extra_players,
+                                   std::map<int64_t, guint>* grants) {
+  guint remaining = g_get_num_processors();
+  guint automatic = extra_players;
+  for (const auto& pair : *self->players) {
+    auto it = self->thread_requests->find(pair.first);
+    if (it == self->thread_requests->end()) {
+      automatic++;
+      continue;
+    }
+    guint grant = CLAMP(it->second, 1u, MAX(remaining, 1u));
+    remaining -= MIN(grant, remaining);
+    if (grants != nullptr) (*grants)[pair.first] = grant;
+  }
+  return MAX(remaining / MAX(automatic, 1u), 1u);
+}
+
+static void rebalance_conversion_threads(FlAvPlayerPlugin* self) {
+  std::map<int64_t, guint> grants;
+  guint share = compute_thread_shares(self, 0, &grants);
+  for (const auto& pair : *self->players) {
+    auto it = grants.find(pair.first);
+    player_instance_set_conversion_threads(
+        pair.second, it != grants.end() ? it->second : share);
+  }
+}
+
 // =============================================================================
 // Event channel listen/cancel callbacks
 // =============================================================================
@@ -51,61 +140,251 @@ static PlayerInstance* find_player_by_id(FlAvPlayerPlugin* self,
 static FlMethodErrorResponse* on_event_listen(FlEventChannel* channel,
                                                 FlValue* args,
                                                 gpointer user_data) {
+  player_instance_on_listen(static_cast<PlayerInstance*>(user_data));
   return nullptr;  // Accept all listeners
 }
 
 static FlMethodErrorResponse* on_event_cancel(FlEventChannel* channel,
                                                 FlValue* args,
                                                 gpointer user_data) {
+  player_instance_on_cancel(static_cast<PlayerInstance*>(user_data));
   return nullptr;
 }
 
+// Creates the player's event channel, named after its texture ID. The
+// player holds the only reference, so the channel goes away with it.
+static void attach_event_channel(FlAvPlayerPlugin* self,
+                                 PlayerInstance* player) {
+  FlBinaryMessenger* messenger =
+      fl_plugin_registrar_get_messenger(self->registrar);
+  g_autofree gchar* event_channel_name =
+      g_strdup_printf("%s%" G_GINT64_FORMAT, kEventChannelPrefix,
+                      player_instance_get_texture_id(player));
+  g_autoptr(FlStandardMethodCodec) event_codec = fl_standard_method_codec_new();
+  g_autoptr(FlEventChannel) event_ch = fl_event_channel_new(
+      messenger, event_channel_name, FL_METHOD_CODEC(event_codec));
+  fl_event_channel_set_stream_handlers(event_ch, on_event_listen,
+                                        on_event_cancel, player, nullptr);
+  player_instance_set_event_channel(player, event_ch);
+  player_instance_set_event_api(player, self->event_api);
+}
+
+static void update_idle_memory_check(FlAvPlayerPlugin* self);
+
 // =============================================================================
-// Pigeon host API handler: create
+// Preload pool
 // =============================================================================
 
-static void handle_create(AvPlayerVideoSourceMessage* source,
-                           AvPlayerAvPlayerHostApiResponseHandle* response_handle,
-                           gpointer user_data) {
-  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+// Removes and returns the pooled player for |uri|, or nullptr if there is
+// none or its pipeline failed.
+static PlayerInstance* take_pooled_player(FlAvPlayerPlugin* self,
+                                          const gchar* uri) {
+  for (auto it = self->pool->begin(); it != self->pool->end(); ++it) {
+    if (it->uri != uri) continue;
+    PlayerInstance* player = it->player;
+    self->pool->erase(it);
+    update_idle_memory_check(self);
+    if (player_instance_has_failed(player)) {
+      player_instance_dispose(player);
+      return nullptr;
+    }
+    return player;
+  }
+  return nullptr;
+}
 
-  AvPlayerSourceType type = av_player_video_source_message_get_type_(source);
+// Evicts the oldest players past |max_players| or |max_bytes|.
+static void trim_pool(FlAvPlayerPlugin* self,
+                      size_t max_players,
+                      size_t max_bytes) {
+  size_t bytes = 0;
+  for (const auto& entry : *self->pool) {
+    bytes += player_instance_estimate_memory(entry.player);
+  }
+  while (!self->pool->empty() &&
+         (self->pool->size() > max_players || bytes > max_bytes)) {
+    PlayerInstance* player = self->pool->back().player;
+    bytes -= MIN(bytes, player_instance_estimate_memory(player));
+    player_instance_dispose(player);
+    self->pool->pop_back();
+  }
+  update_idle_memory_check(self);
+}
+
+// Evicts the oldest players past the limits for the last memory level.
+static void trim_pool_to_limits(FlAvPlayerPlugin* self) {
+  if (self->memory_level != nullptr) {
+    trim_pool(self, kPoolLowMemoryMaxPlayers, kPoolLowMemoryMaxBytes);
+  } else {
+    trim_pool(self, kPoolMaxPlayers, kPoolMaxBytes);
+  }
+}
+
+// =============================================================================
+// Memory pressure
+// =============================================================================
+
+// Reads /proc/meminfo. Returns "warning" or "critical" and sets |free_pct|
+// when memory runs low, nullptr otherwise. Any thread.
+static const char* read_memory_pressure(double* free_pct) {
+  std::ifstream meminfo("/proc/meminfo");
+  if (!meminfo.is_open()) return nullptr;
+
+  long mem_total = 0, mem_available = 0;
+  std::string line;
+  while (std::getline(meminfo, line)) {
+    if (line.find("MemTotal:") == 0) {
+      sscanf(line.c_str(), "MemTotal: %ld", &mem_total);
+    } else if (line.find("MemAvailable:") == 0) {
+      sscanf(line.c_str(), "MemAvailable: %ld", &mem_available);
+    }
+  }
+
+  if (mem_total <= 0) return nullptr;
+
+  *free_pct = static_cast<double>(mem_available) / mem_total;
+  if (*free_pct < 0.05) return "critical";
+  if (*free_pct < 0.15) return "warning";
+  return nullptr;
+}
+
+// Shrinks the pool to its low-memory limits at "warning", and empties it and
+// the idle frame buffers at "critical". Returns whether memory is critical.
+// Main thread.
+static gboolean check_memory_pressure(FlAvPlayerPlugin* self) {
+  if (self->pool == nullptr) return FALSE;
+  double free_pct = 0;
+  const char* level = read_memory_pressure(&free_pct);
+  if (g_strcmp0(level, self->memory_level) != 0) {
+    // TODO: Notify player instances of memory pressure once
+    // player_instance_send_event() is exposed in player_instance.h.
+    if (level != nullptr) {
+      g_warning("av_player: memory pressure level=%s (%.1f%% free)", level,
+                free_pct * 100.0);
+    }
+    self->memory_level = level;
+  }
+  if (level == nullptr) return FALSE;
 
-  // Build URI
-  const char* uri = nullptr;
-  g_autofree gchar* uri_buf = nullptr;
+  if (strcmp(level, "critical") != 0) {
+    trim_pool_to_limits(self);
+    return FALSE;
+  }
+  frame_buffer_pool_trim();
+  // Warm players are only a head start; give their memory back first.
+  trim_pool(self, 0, 0);
+  return TRUE;
+}
 
-  switch (type) {
+static gboolean check_memory_pressure_cb(gpointer user_data) {
+  check_memory_pressure(FL_AV_PLAYER_PLUGIN(user_data));
+  return G_SOURCE_REMOVE;
+}
+
+static gboolean idle_memory_check_cb(gpointer user_data) {
+  check_memory_pressure(FL_AV_PLAYER_PLUGIN(user_data));
+  return G_SOURCE_CONTINUE;
+}
+
+// Starts or stops the idle memory check to match the players held. The tick
+// checks more often, but only while some player plays. Main thread.
+static void update_idle_memory_check(FlAvPlayerPlugin* self) {
+  if (self->players == nullptr || self->pool == nullptr) return;
+  gboolean wanted = !self->players->empty() || !self->pool->empty();
+  if (wanted && self->idle_memory_check_id == 0) {
+    self->idle_memory_check_id = g_timeout_add_seconds(
+        kIdleMemoryCheckIntervalS, idle_memory_check_cb, self);
+  } else if (!wanted && self->idle_memory_check_id != 0) {
+    g_clear_handle_id(&self->idle_memory_check_id, g_source_remove);
+  }
+}
+
+// =============================================================================
+// Tick scheduler
+// =============================================================================
+
+// One wakeup for all playing players, plus the periodic memory check.
+static gboolean scheduler_tick(gpointer user_data) {
+  auto* scheduler = static_cast<TickScheduler*>(user_data);
+  for (PlayerInstance* player : scheduler->playing) {
+    player_instance_tick(player);
+  }
+
+  gint64 now_us = g_get_monotonic_time();
+  if (now_us - scheduler->last_memory_check_us >= kMemoryCheckIntervalUs) {
+    scheduler->last_memory_check_us = now_us;
+    // The pool belongs to the main thread, which re-reads the level there.
+    double free_pct = 0;
+    const char* level = read_memory_pressure(&free_pct);
+    gboolean changed = g_strcmp0(level, scheduler->last_memory_level) != 0;
+    scheduler->last_memory_level = level;
+    if (level != nullptr || changed) {
+      g_idle_add_full(G_PRIORITY_DEFAULT, check_memory_pressure_cb,
+                      g_object_ref(scheduler->plugin), g_object_unref);
+    }
+  }
+  return G_SOURCE_CONTINUE;
+}
+
+// Starts or stops the tick to match the playing players.
+static void scheduler_update_source(TickScheduler* scheduler) {
+  gboolean wanted =
+      scheduler->plugin != nullptr && !scheduler->playing.empty();
+  if (wanted && scheduler->source == nullptr) {
+    scheduler->source = g_timeout_source_new(kTickIntervalMs);
+    g_source_set_callback(scheduler->source, scheduler_tick, scheduler,
+                          nullptr);
+    g_source_attach(scheduler->source, control_thread_get_context());
+  } else if (!wanted && scheduler->source != nullptr) {
+    g_source_destroy(scheduler->source);
+    g_source_unref(scheduler->source);
+    scheduler->source = nullptr;
+  }
+}
+
+static void on_player_playing(PlayerInstance* player,
+                              gboolean playing,
+                              gpointer user_data) {
+  auto* scheduler = static_cast<TickScheduler*>(user_data);
+  auto& list = scheduler->playing;
+  if (playing) {
+    list.push_back(player);
+  } else {
+    list.erase(std::remove(list.begin(), list.end(), player), list.end());
+  }
+  scheduler_update_source(scheduler);
+}
+
+// =============================================================================
+// Source URIs
+// =============================================================================
+
+// Builds the playbin URI for |source|. Returns nullptr and sets |error| to a
+// static message when the source is incomplete.
+static gchar* uri_for_source(AvPlayerVideoSourceMessage* source,
+                             const gchar** error) {
+  switch (av_player_video_source_message_get_type_(source)) {
     case AV_PLAYER_SOURCE_TYPE_NETWORK: {
       const gchar* url = av_player_video_source_message_get_url(source);
       if (url == nullptr) {
-        av_player_av_player_host_api_respond_error_create(
-            response_handle, "INVALID_SOURCE",
-            "Network source requires 'url'.", nullptr);
-        return;
+        *error = "Network source requires 'url'.";
+        return nullptr;
       }
-      uri = url;
-      break;
+      return g_strdup(url);
     }
     case AV_PLAYER_SOURCE_TYPE_FILE: {
       const gchar* path = av_player_video_source_message_get_file_path(source);
       if (path == nullptr) {
-        av_player_av_player_host_api_respond_error_create(
-            response_handle, "INVALID_SOURCE",
-            "File source requires 'filePath'.", nullptr);
-        return;
+        *error = "File source requires 'filePath'.";
+        return nullptr;
       }
-      uri_buf = g_strdup_printf("file://%s", path);
-      uri = uri_buf;
-      break;
+      return g_strdup_printf("file://%s", path);
     }
     case AV_PLAYER_SOURCE_TYPE_ASSET: {
       const gchar* asset = av_player_video_source_message_get_asset_path(source);
       if (asset == nullptr) {
-        av_player_av_player_host_api_respond_error_create(
-            response_handle, "INVALID_SOURCE",
-            "Asset source requires 'assetPath'.", nullptr);
-        return;
+        *error = "Asset source requires 'assetPath'.";
+        return nullptr;
       }
       // Assets are bundled in the flutter_assets directory relative to the executable
       g_autofree gchar* exe_dir = g_path_get_dirname("/proc/self/exe");
@@ -115,41 +394,101 @@ static void handle_create(AvPlayerVideoSourceMessage* source,
         exe_dir = g_path_get_dirname(resolved);
         g_free(resolved);
       }
-      uri_buf = g_strdup_printf("file://%s/data/flutter_assets/%s",
-                                 exe_dir, asset);
-      uri = uri_buf;
-      break;
+      return g_strdup_printf("file://%s/data/flutter_assets/%s", exe_dir,
+                             asset);
     }
     default:
-      av_player_av_player_host_api_respond_error_create(
-          response_handle, "INVALID_SOURCE", "Unknown source type.", nullptr);
-      return;
+      *error = "Unknown source type.";
+      return nullptr;
   }
+}
 
-  FlTextureRegistrar* tex_reg =
-      fl_plugin_registrar_get_texture_registrar(self->registrar);
-  FlBinaryMessenger* messenger =
-      fl_plugin_registrar_get_messenger(self->registrar);
+// =============================================================================
+// Pigeon host API handler: create
+// =============================================================================
 
-  // Step 1: Create player with null event channel to get texture ID
-  PlayerInstance* player = player_instance_new(tex_reg, nullptr, uri);
-  int64_t texture_id = player_instance_get_texture_id(player);
+// A create or preload request waiting for its pipeline to be built.
+struct PendingPlayer {
+  FlAvPlayerPlugin* self;
+  AvPlayerAvPlayerHostApiResponseHandle* response_handle;
+  std::string uri;
+  gint64 start_us;
+};
 
-  // Step 2: Create event channel with the correct name based on texture ID
-  g_autofree gchar* event_channel_name =
-      g_strdup_printf("%s%" G_GINT64_FORMAT, kEventChannelPrefix, texture_id);
-  g_autoptr(FlStandardMethodCodec) event_codec = fl_standard_method_codec_new();
-  FlEventChannel* event_ch = fl_event_channel_new(
-      messenger, event_channel_name, FL_METHOD_CODEC(event_codec));
-  fl_event_channel_set_stream_handlers(event_ch, on_event_listen,
-                                        on_event_cancel, nullptr, nullptr);
+static void pending_player_free(PendingPlayer* pending) {
+  g_object_unref(pending->response_handle);
+  g_object_unref(pending->self);
+  delete pending;
+}
 
-  // Step 3: Set the event channel on the player
-  player_instance_set_event_channel(player, event_ch);
+// Hands |player| to Dart: names its event channel after the texture and
+// answers create with the time taken since |start_us|.
+static void finish_create(FlAvPlayerPlugin* self,
+                          PlayerInstance* player,
+                          AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                          gint64 start_us) {
+  int64_t texture_id = player_instance_get_texture_id(player);
+  attach_event_channel(self, player);
+  player_instance_set_playing_callback(player, on_player_playing,
+                                       self->scheduler);
 
   (*self->players)[texture_id] = player;
+  rebalance_conversion_threads(self);
+  update_idle_memory_check(self);
+
+  g_autoptr(AvPlayerCreateResultMessage) result =
+      av_player_create_result_message_new(texture_id,
+                                          g_get_monotonic_time() - start_us);
+  av_player_av_player_host_api_respond_create(response_handle, result);
+}
+
+static void on_create_built(GObject* source_object,
+                            GAsyncResult* result,
+                            gpointer user_data) {
+  auto* pending = static_cast<PendingPlayer*>(user_data);
+  PlayerInstance* player = player_instance_new_finish(result);
+  if (pending->self->players == nullptr) {
+    // The plugin was disposed while the pipeline was built.
+    player_instance_dispose(player);
+  } else {
+    finish_create(pending->self, player, pending->response_handle,
+                  pending->start_us);
+  }
+  pending_player_free(pending);
+}
+
+static void handle_create(AvPlayerVideoSourceMessage* source,
+                           AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                           gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+
+  const gchar* error = nullptr;
+  g_autofree gchar* uri = uri_for_source(source, &error);
+  if (uri == nullptr) {
+    av_player_av_player_host_api_respond_error_create(
+        response_handle, "INVALID_SOURCE", error, nullptr);
+    return;
+  }
+
+  // A preloaded player is usually prerolled already; its initialized event
+  // is replayed when Dart starts listening.
+  gint64 start_us = g_get_monotonic_time();
+  PlayerInstance* player = take_pooled_player(self, uri);
+  if (player != nullptr) {
+    player_instance_set_prerolled_callback(player, nullptr, nullptr);
+    finish_create(self, player, response_handle, start_us);
+    return;
+  }
 
-  av_player_av_player_host_api_respond_create(response_handle, texture_id);
+  // Built on a worker thread, with its conversion thread share.
+  FlTextureRegistrar* tex_reg =
+      fl_plugin_registrar_get_texture_registrar(self->registrar);
+  player_instance_new_async(
+      tex_reg, uri, compute_thread_shares(self, 1, nullptr), on_create_built,
+      new PendingPlayer{FL_AV_PLAYER_PLUGIN(g_object_ref(self)),
+                        AV_PLAYER_AV_PLAYER_HOST_API_RESPONSE_HANDLE(
+                            g_object_ref(response_handle)),
+                        uri, start_us});
 }
 
 // =============================================================================
@@ -164,6 +503,11 @@ static void handle_dispose(int64_t player_id,
   if (it != self->players->end()) {
     player_instance_dispose(it->second);
     self->players->erase(it);
+    self->thread_requests->erase(player_id);
+    rebalance_conversion_threads(self);
+    // Nothing will reuse the idle frame buffers soon.
+    if (self->players->empty()) frame_buffer_pool_trim();
+    update_idle_memory_check(self);
   }
   av_player_av_player_host_api_respond_dispose(response_handle);
 }
@@ -210,6 +554,7 @@ static void handle_pause(int64_t player_id,
 
 static void handle_seek_to(int64_t player_id,
                             int64_t position_ms,
+                            AvPlayerSeekMode mode,
                             AvPlayerAvPlayerHostApiResponseHandle* response_handle,
                             gpointer user_data) {
   auto* self = FL_AV_PLAYER_PLUGIN(user_data);
@@ -219,7 +564,7 @@ static void handle_seek_to(int64_t player_id,
         response_handle, "NO_PLAYER", "Player not found.", nullptr);
     return;
   }
-  player_instance_seek_to(p, position_ms);
+  player_instance_seek_to(p, position_ms, mode);
   av_player_av_player_host_api_respond_seek_to(response_handle);
 }
 
@@ -280,6 +625,258 @@ static void handle_set_volume(int64_t player_id,
   av_player_av_player_host_api_respond_set_volume(response_handle);
 }
 
+// =============================================================================
+// Pigeon host API handler: setRenderSize
+// =============================================================================
+
+static void handle_set_render_size(int64_t player_id,
+                                   int64_t width,
+                                   int64_t height,
+                                   AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                                   gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  PlayerInstance* p = find_player_by_id(self, player_id);
+  if (p == nullptr) {
+    av_player_av_player_host_api_respond_error_set_render_size(
+        response_handle, "NO_PLAYER", "Player not found.", nullptr);
+    return;
+  }
+  player_instance_set_render_size(p, static_cast<int32_t>(width),
+                                  static_cast<int32_t>(height));
+  av_player_av_player_host_api_respond_set_render_size(response_handle);
+}
+
+// =============================================================================
+// Pigeon host API handler: setNativeColorConversion
+// =============================================================================
+
+static void handle_set_native_color_conversion(int64_t player_id,
+                                               gboolean enabled,
+                                               AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                                               gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  PlayerInstance* p = find_player_by_id(self, player_id);
+  if (p == nullptr) {
+    av_player_av_player_host_api_respond_error_set_native_color_conversion(
+        response_handle, "NO_PLAYER", "Player not found.", nullptr);
+    return;
+  }
+  player_instance_set_native_conversion(p, enabled);
+  av_player_av_player_host_api_respond_set_native_color_conversion(response_handle);
+}
+
+// =============================================================================
+// Pigeon host API handler: setConversionThreads
+// =============================================================================
+
+static void handle_set_conversion_threads(int64_t player_id,
+                                          int64_t threads,
+                                          AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                                          gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  PlayerInstance* p = find_player_by_id(self, player_id);
+  if (p == nullptr) {
+    av_player_av_player_host_api_respond_error_set_conversion_threads(
+        response_handle, "NO_PLAYER", "Player not found.", nullptr);
+    return;
+  }
+  if (threads > 0) {
+    (*self->thread_requests)[player_id] =
+        static_cast<guint>(MIN(threads, static_cast<int64_t>(G_MAXUINT)));
+  } else {
+    self->thread_requests->erase(player_id);
+  }
+  rebalance_conversion_threads(self);
+  av_player_av_player_host_api_respond_set_conversion_threads(response_handle);
+}
+
+// =============================================================================
+// Pigeon host API handler: getRenderStats
+// =============================================================================
+
+static void handle_get_render_stats(int64_t player_id,
+                                    AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                                    gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  PlayerInstance* p = find_player_by_id(self, player_id);
+  if (p == nullptr) {
+    av_player_av_player_host_api_respond_error_get_render_stats(
+        response_handle, "NO_PLAYER", "Player not found.", nullptr);
+    return;
+  }
+  PlayerRenderStats stats;
+  player_instance_get_render_stats(p, &stats);
+  g_autoptr(AvPlayerRenderStatsMessage) message =
+      av_player_render_stats_message_new(
+          stats.frames_decoded, stats.frames_presented, stats.frames_dropped,
+          stats.conversion_us[0], stats.conversion_us[1],
+          stats.conversion_us[2], stats.copy_us[0], stats.copy_us[1],
+          stats.copy_us[2], stats.lateness_us[0], stats.lateness_us[1],
+          stats.lateness_us[2], stats.audio_filter_us[0],
+          stats.audio_filter_us[1], stats.audio_filter_us[2]);
+  av_player_av_player_host_api_respond_get_render_stats(response_handle,
+                                                        message);
+}
+
+// =============================================================================
+// Pigeon host API handler: getKeyframes
+// =============================================================================
+
+static void handle_get_keyframes(int64_t player_id,
+                                 AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                                 gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  PlayerInstance* p = find_player_by_id(self, player_id);
+  if (p == nullptr) {
+    av_player_av_player_host_api_respond_error_get_keyframes(
+        response_handle, "NO_PLAYER", "Player not found.", nullptr);
+    return;
+  }
+  GArray* positions = player_instance_get_keyframes(p);
+  g_autoptr(FlValue) list = fl_value_new_list();
+  for (guint i = 0; i < positions->len; i++) {
+    fl_value_append_take(list,
+                         fl_value_new_int(g_array_index(positions, gint64, i)));
+  }
+  g_array_unref(positions);
+  av_player_av_player_host_api_respond_get_keyframes(response_handle, list);
+}
+
+// =============================================================================
+// Pigeon host API handler: queueNext
+// =============================================================================
+
+static void handle_queue_next(int64_t player_id,
+                              AvPlayerVideoSourceMessage* source,
+                              AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                              gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  PlayerInstance* p = find_player_by_id(self, player_id);
+  if (p == nullptr) {
+    av_player_av_player_host_api_respond_error_queue_next(
+        response_handle, "NO_PLAYER", "Player not found.", nullptr);
+    return;
+  }
+  const gchar* error = nullptr;
+  g_autofree gchar* uri = uri_for_source(source, &error);
+  if (uri == nullptr) {
+    av_player_av_player_host_api_respond_error_queue_next(
+        response_handle, "INVALID_SOURCE", error, nullptr);
+    return;
+  }
+  player_instance_queue_next(p, uri);
+  av_player_av_player_host_api_respond_queue_next(response_handle, TRUE);
+}
+
+// =============================================================================
+// Pigeon host API handler: setSource
+// =============================================================================
+
+static void handle_set_source(int64_t player_id,
+                              AvPlayerVideoSourceMessage* source,
+                              AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                              gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  PlayerInstance* p = find_player_by_id(self, player_id);
+  if (p == nullptr) {
+    av_player_av_player_host_api_respond_error_set_source(
+        response_handle, "NO_PLAYER", "Player not found.", nullptr);
+    return;
+  }
+  const gchar* error = nullptr;
+  g_autofree gchar* uri = uri_for_source(source, &error);
+  if (uri == nullptr) {
+    av_player_av_player_host_api_respond_error_set_source(
+        response_handle, "INVALID_SOURCE", error, nullptr);
+    return;
+  }
+  player_instance_set_source(p, uri);
+  av_player_av_player_host_api_respond_set_source(response_handle, TRUE);
+}
+
+// =============================================================================
+// Pigeon host API handler: preload
+// =============================================================================
+
+// A pooled player's frame size became known; re-check the byte cap.
+static void on_pooled_player_prerolled(PlayerInstance* player,
+                                       gpointer user_data) {
+  trim_pool_to_limits(FL_AV_PLAYER_PLUGIN(user_data));
+}
+
+static void respond_memory_pressure(
+    AvPlayerAvPlayerHostApiResponseHandle* response_handle) {
+  av_player_av_player_host_api_respond_error_preload(
+      response_handle, "MEMORY_PRESSURE",
+      "Memory is low; the source was not preloaded.", nullptr);
+}
+
+static void on_preload_built(GObject* source_object,
+                             GAsyncResult* result,
+                             gpointer user_data) {
+  auto* pending = static_cast<PendingPlayer*>(user_data);
+  FlAvPlayerPlugin* self = pending->self;
+  PlayerInstance* player = player_instance_new_finish(result);
+  if (self->pool == nullptr) {
+    // The plugin was disposed while the pipeline was built.
+    player_instance_dispose(player);
+  } else if (check_memory_pressure(self)) {
+    player_instance_dispose(player);
+    respond_memory_pressure(pending->response_handle);
+  } else {
+    // An earlier preload of the same source may have finished first.
+    PlayerInstance* pooled = take_pooled_player(self, pending->uri.c_str());
+    if (pooled != nullptr) {
+      player_instance_dispose(player);
+      player = pooled;
+    }
+    // Still prerolling, so it counts as zero bytes until it reports in.
+    player_instance_set_prerolled_callback(player, on_pooled_player_prerolled,
+                                           self);
+    self->pool->push_front({pending->uri, player});
+    trim_pool_to_limits(self);
+    av_player_av_player_host_api_respond_preload(pending->response_handle);
+  }
+  pending_player_free(pending);
+}
+
+static void handle_preload(AvPlayerVideoSourceMessage* source,
+                           AvPlayerAvPlayerHostApiResponseHandle* response_handle,
+                           gpointer user_data) {
+  auto* self = FL_AV_PLAYER_PLUGIN(user_data);
+  const gchar* error = nullptr;
+  g_autofree gchar* uri = uri_for_source(source, &error);
+  if (uri == nullptr) {
+    av_player_av_player_host_api_respond_error_preload(
+        response_handle, "INVALID_SOURCE", error, nullptr);
+    return;
+  }
+
+  PlayerInstance* player = take_pooled_player(self, uri);
+  if (player != nullptr) {
+    self->pool->push_front({uri, player});
+    update_idle_memory_check(self);
+    av_player_av_player_host_api_respond_preload(response_handle);
+    return;
+  }
+  if (check_memory_pressure(self)) {
+    respond_memory_pressure(response_handle);
+    return;
+  }
+
+  // Built like create(); it prerolls and waits to be claimed. Pooled players
+  // convert only their preroll frame, so they stay out of the thread budget
+  // with one thread; finish_create() rebalances once one is claimed.
+  FlTextureRegistrar* tex_reg =
+      fl_plugin_registrar_get_texture_registrar(self->registrar);
+  player_instance_new_async(
+      tex_reg, uri, 1, on_preload_built,
+      new PendingPlayer{FL_AV_PLAYER_PLUGIN(g_object_ref(self)),
+                        AV_PLAYER_AV_PLAYER_HOST_API_RESPONSE_HANDLE(
+                            g_object_ref(response_handle)),
+                        uri, g_get_monotonic_time()});
+}
+
 // =============================================================================
 // Pigeon host API handler: isPipAvailable
 // =============================================================================
@@ -478,46 +1075,6 @@ static void handle_select_subtitle_track(AvPlayerSelectSubtitleTrackRequest* req
   av_player_av_player_host_api_respond_select_subtitle_track(response_handle);
 }
 
-// =============================================================================
-// Memory pressure polling
-// =============================================================================
-
-static gboolean check_memory_pressure(gpointer user_data) {
-  (void)user_data;
-
-  std::ifstream meminfo("/proc/meminfo");
-  if (!meminfo.is_open()) return G_SOURCE_CONTINUE;
-
-  long mem_total = 0, mem_available = 0;
-  std::string line;
-  while (std::getline(meminfo, line)) {
-    if (line.find("MemTotal:") == 0) {
-      sscanf(line.c_str(), "MemTotal: %ld", &mem_total);
-    } else if (line.find("MemAvailable:") == 0) {
-      sscanf(line.c_str(), "MemAvailable: %ld", &mem_available);
-    }
-  }
-
-  if (mem_total <= 0) return G_SOURCE_CONTINUE;
-
-  double free_pct = static_cast<double>(mem_available) / mem_total;
-  const char* level = nullptr;
-  if (free_pct < 0.05) {
-    level = "critical";
-  } else if (free_pct < 0.15) {
-    level = "warning";
-  }
-
-  if (level != nullptr) {
-    // TODO: Notify player instances of memory pressure once
-    // player_instance_send_event() is exposed in player_instance.h.
-    g_warning("av_player: memory pressure level=%s (%.1f%% free)", level,
-              free_pct * 100.0);
-  }
-
-  return G_SOURCE_CONTINUE;
-}
-
 // =============================================================================
 // VTable
 // =============================================================================
@@ -545,6 +1102,14 @@ static const AvPlayerAvPlayerHostApiVTable kVTable = {
     .get_decoder_info = handle_get_decoder_info,
     .get_subtitle_tracks = handle_get_subtitle_tracks,
     .select_subtitle_track = handle_select_subtitle_track,
+    .set_render_size = handle_set_render_size,
+    .set_native_color_conversion = handle_set_native_color_conversion,
+    .set_conversion_threads = handle_set_conversion_threads,
+    .get_render_stats = handle_get_render_stats,
+    .get_keyframes = handle_get_keyframes,
+    .queue_next = handle_queue_next,
+    .preload = handle_preload,
+    .set_source = handle_set_source,
 };
 
 // =============================================================================
@@ -554,6 +1119,17 @@ static const AvPlayerAvPlayerHostApiVTable kVTable = {
 static void fl_av_player_plugin_dispose(GObject* object) {
   auto* self = FL_AV_PLAYER_PLUGIN(object);
 
+  // Stop ticking first.
+  g_clear_handle_id(&self->idle_memory_check_id, g_source_remove);
+  TickScheduler* scheduler = self->scheduler;
+  self->scheduler = nullptr;
+  if (scheduler != nullptr) {
+    control_thread_run_sync([scheduler] {
+      scheduler->plugin = nullptr;
+      scheduler_update_source(scheduler);
+    });
+  }
+
   if (self->players) {
     for (auto& pair : *self->players) {
       player_instance_dispose(pair.second);
@@ -562,11 +1138,27 @@ static void fl_av_player_plugin_dispose(GObject* object) {
     self->players = nullptr;
   }
 
+  delete self->thread_requests;
+  self->thread_requests = nullptr;
+
+  if (self->pool) {
+    for (auto& entry : *self->pool) {
+      player_instance_dispose(entry.player);
+    }
+    delete self->pool;
+    self->pool = nullptr;
+  }
+
+  if (scheduler != nullptr) {
+    control_thread_run_sync([scheduler] { delete scheduler; });
+  }
+
   // Clear Pigeon method handlers
   FlBinaryMessenger* messenger =
       fl_plugin_registrar_get_messenger(self->registrar);
   av_player_av_player_host_api_clear_method_handlers(messenger, nullptr);
 
+  g_clear_object(&self->event_api);
   g_clear_object(&self->registrar);
 
   G_OBJECT_CLASS(fl_av_player_plugin_parent_class)->dispose(object);
@@ -587,6 +1179,9 @@ FlAvPlayerPlugin* fl_av_player_plugin_new(
 
   self->registrar = FL_PLUGIN_REGISTRAR(g_object_ref(registrar));
   self->players = new std::map<int64_t, PlayerInstance*>();
+  self->thread_requests = new std::map<int64_t, guint>();
+  self->pool = new std::list<PooledPlayer>();
+  self->scheduler = new TickScheduler{self, {}, nullptr, 0, nullptr};
 
   // Initialize GStreamer (safe to call multiple times)
   gst_init(nullptr, nullptr);
@@ -594,13 +1189,11 @@ FlAvPlayerPlugin* fl_av_player_plugin_new(
   // Register Pigeon host API handlers
   FlBinaryMessenger* messenger =
       fl_plugin_registrar_get_messenger(registrar);
+  self->event_api = av_player_av_player_event_api_new(messenger, nullptr);
   av_player_av_player_host_api_set_method_handlers(
       messenger, nullptr, &kVTable,
       g_object_ref(self), g_object_unref);
 
-  // Start memory pressure polling (every 5 seconds)
-  g_timeout_add_seconds(5, check_memory_pressure, self);
-
   return self;
 }
 
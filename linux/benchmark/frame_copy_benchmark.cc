@@ -0,0 +1,136 @@
+// Times the RGBA copy of the videoconvert path from 480p to 4K, into
+// frame_buffer_pool buffers like the plugin: plain memcpy, the streaming-store
+// path of frame_copy.cc at every size, and frame_copy_rows() as the plugin
+// calls it, which streams only frames past its size threshold.
+// Sources are packed, or have a cache line of padding after every row, which
+// takes the copies down their row-by-row path.
+//
+// Usage: frame_copy_benchmark [iterations]
+
+#include <glib.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "frame_buffer_pool.h"
+#include "frame_copy.h"
+
+namespace {
+
+struct Resolution {
+  const char* name;
+  int width;
+  int height;
+};
+
+const Resolution kResolutions[] = {
+    {"480p", 854, 480},
+    {"720p", 1280, 720},
+    {"1080p", 1920, 1080},
+    {"4K", 3840, 2160},
+};
+
+const int kWarmupIterations = 5;
+const size_t kRowPadding = 64;
+
+typedef void (*FrameCopy)(uint8_t* dst,
+                          const uint8_t* src,
+                          int src_stride,
+                          size_t row_bytes,
+                          int height);
+
+struct Variant {
+  const char* name;
+  FrameCopy copy;
+};
+
+// The copy before frame_copy.cc: memcpy, one call per row unless packed.
+void copy_memcpy(uint8_t* dst,
+                 const uint8_t* src,
+                 int src_stride,
+                 size_t row_bytes,
+                 int height) {
+  if (static_cast<size_t>(src_stride) == row_bytes) {
+    memcpy(dst, src, row_bytes * height);
+    return;
+  }
+  for (int y = 0; y < height; y++) {
+    memcpy(dst, src, row_bytes);
+    dst += row_bytes;
+    src += src_stride;
+  }
+}
+
+const Variant kVariants[] = {
+    {"memcpy", copy_memcpy},
+    {"stream", frame_copy_rows_streaming},
+    {"plugin", frame_copy_rows},
+};
+
+// Median and 95th percentile of one frame copy, in microseconds.
+void time_copy(const Variant& variant,
+               uint8_t* dst,
+               const uint8_t* src,
+               int src_stride,
+               const Resolution& res,
+               int iterations,
+               gint64* p50_us,
+               gint64* p95_us) {
+  const size_t row_bytes = static_cast<size_t>(res.width) * 4;
+  auto copy_frame = [&] {
+    variant.copy(dst, src, src_stride, row_bytes, res.height);
+  };
+
+  for (int i = 0; i < kWarmupIterations; i++) copy_frame();
+  std::vector<gint64> samples(iterations);
+  for (int i = 0; i < iterations; i++) {
+    gint64 start_us = g_get_monotonic_time();
+    copy_frame();
+    samples[i] = g_get_monotonic_time() - start_us;
+  }
+  std::sort(samples.begin(), samples.end());
+  *p50_us = samples[iterations / 2];
+  *p95_us = samples[std::min(iterations - 1, iterations * 95 / 100)];
+}
+
+void bench_resolution(const Resolution& res, int iterations) {
+  const size_t row_bytes = static_cast<size_t>(res.width) * 4;
+  const size_t padded = row_bytes + kRowPadding;
+  const size_t frame_bytes = row_bytes * res.height;
+
+  std::vector<uint8_t> src(padded * res.height);
+  for (size_t i = 0; i < src.size(); i++) src[i] = static_cast<uint8_t>(i);
+  uint8_t* dst = frame_buffer_pool_acquire(frame_bytes);
+
+  const int strides[] = {static_cast<int>(row_bytes), static_cast<int>(padded)};
+  for (int stride : strides) {
+    for (const Variant& variant : kVariants) {
+      const char* layout =
+          static_cast<size_t>(stride) == row_bytes ? "packed" : "padded";
+      gint64 p50 = 0, p95 = 0;
+      time_copy(variant, dst, src.data(), stride, res, iterations, &p50, &p95);
+      g_print("%-6s %-7s %-8s  %8" G_GINT64_FORMAT " %8" G_GINT64_FORMAT
+              "  %6.2f GB/s\n",
+              res.name, layout, variant.name, p50, p95,
+              p50 > 0 ? static_cast<double>(frame_bytes) / p50 / 1000.0 : 0.0);
+    }
+  }
+  frame_buffer_pool_release(dst, frame_bytes);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int iterations = argc > 1 ? MAX(atoi(argv[1]), 1) : 100;
+  g_print("streaming path: %s, %d iterations\n", frame_copy_backend_name(),
+          iterations);
+  g_print("%-6s %-7s %-8s  %8s %8s  %11s\n", "size", "layout", "copy", "p50 us",
+          "p95 us", "throughput");
+  for (const Resolution& res : kResolutions) {
+    bench_resolution(res, iterations);
+  }
+  frame_buffer_pool_trim();
+  return 0;
+}
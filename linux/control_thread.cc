@@ -0,0 +1,61 @@
+#include "control_thread.h"
+
+namespace {
+
+using Task = std::function<void()>;
+
+gpointer control_thread_main(gpointer data) {
+  auto* context = static_cast<GMainContext*>(data);
+  g_main_context_push_thread_default(context);
+  GMainLoop* loop = g_main_loop_new(context, FALSE);
+  g_main_loop_run(loop);
+  return nullptr;
+}
+
+gboolean run_task(gpointer data) {
+  (*static_cast<Task*>(data))();
+  return G_SOURCE_REMOVE;
+}
+
+void free_task(gpointer data) {
+  delete static_cast<Task*>(data);
+}
+
+}  // namespace
+
+GMainContext* control_thread_get_context() {
+  static GMainContext* context = [] {
+    GMainContext* ctx = g_main_context_new();
+    g_thread_unref(g_thread_new("av_player-control", control_thread_main, ctx));
+    return ctx;
+  }();
+  return context;
+}
+
+void control_thread_post(std::function<void()> task) {
+  g_main_context_invoke_full(control_thread_get_context(), G_PRIORITY_DEFAULT,
+                             run_task, new Task(std::move(task)), free_task);
+}
+
+void control_thread_run_sync(std::function<void()> task) {
+  GMutex lock;
+  GCond cond;
+  gboolean done = FALSE;
+  g_mutex_init(&lock);
+  g_cond_init(&cond);
+
+  control_thread_post([&] {
+    task();
+    g_mutex_lock(&lock);
+    done = TRUE;
+    g_cond_signal(&cond);
+    g_mutex_unlock(&lock);
+  });
+
+  g_mutex_lock(&lock);
+  while (!done) g_cond_wait(&cond, &lock);
+  g_mutex_unlock(&lock);
+
+  g_cond_clear(&cond);
+  g_mutex_clear(&lock);
+}
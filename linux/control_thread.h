@@ -0,0 +1,25 @@
+#ifndef CONTROL_THREAD_H_
+#define CONTROL_THREAD_H_
+
+#include <glib.h>
+
+#include <functional>
+
+// Process-wide thread that runs player bus watches, the plugin's tick and
+// playback control, so GStreamer messages are handled on time even while
+// the GTK main thread is busy with UI work. It owns its own GMainContext;
+// results go back to the main thread as events.
+
+// Context of the control thread, which starts on first use and runs for the
+// life of the process.
+GMainContext* control_thread_get_context();
+
+// Runs |task| on the control thread after everything posted before it.
+// Runs it inline when called on the control thread.
+void control_thread_post(std::function<void()> task);
+
+// Like control_thread_post, but waits for |task| to finish. The control
+// thread never waits on the main thread, so this cannot deadlock.
+void control_thread_run_sync(std::function<void()> task);
+
+#endif  // CONTROL_THREAD_H_
@@ -0,0 +1,138 @@
+#include "frame_buffer_pool.h"
+
+#include <sys/mman.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+// Smallest class; thumbnails and tiny render sizes share it.
+constexpr size_t kMinCapacity = 64 * 1024;
+constexpr size_t kCacheLineAlignment = 64;
+constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+// A few frames: one 4K frame, or the slots of two 1080p players.
+constexpr size_t kMaxIdleBytes = 48 * 1024 * 1024;
+constexpr guint kMaxIdleBuffers = 6;
+
+struct IdleBuffer {
+  uint8_t* buffer;
+  size_t capacity;
+};
+
+// Idle buffers, least recently released first.
+struct Pool {
+  GMutex lock;
+  IdleBuffer idle[kMaxIdleBuffers];
+  guint idle_count;
+  size_t idle_bytes;
+  // Buffers handed out and not yet released.
+  guint outstanding;
+  // Set by a trim that left buffers outstanding; they are freed on release
+  // until the next acquire.
+  gboolean trimming;
+};
+
+Pool* pool() {
+  // Zero-initialised static storage is a valid GMutex and an empty pool.
+  static Pool instance;
+  return &instance;
+}
+
+uint8_t* allocate(size_t capacity) {
+  const size_t alignment =
+      capacity >= kHugePageSize ? kHugePageSize : kCacheLineAlignment;
+  void* memory = nullptr;
+  if (posix_memalign(&memory, alignment, capacity) != 0) {
+    g_error("frame_buffer_pool: failed to allocate %" G_GSIZE_FORMAT " bytes",
+            capacity);
+  }
+#ifdef MADV_HUGEPAGE
+  if (alignment == kHugePageSize) {
+    madvise(memory, capacity, MADV_HUGEPAGE);
+  }
+#endif
+  return static_cast<uint8_t*>(memory);
+}
+
+// Drops idle[index], keeping the rest in release order. Pool lock held.
+IdleBuffer take_idle(Pool* p, guint index) {
+  IdleBuffer entry = p->idle[index];
+  memmove(&p->idle[index], &p->idle[index + 1],
+          (p->idle_count - index - 1) * sizeof(IdleBuffer));
+  p->idle_count--;
+  p->idle_bytes -= entry.capacity;
+  return entry;
+}
+
+}  // namespace
+
+size_t frame_buffer_pool_capacity(size_t size) {
+  if (size <= kMinCapacity) return kMinCapacity;
+  // Four steps between consecutive powers of two.
+  const guint exponent = g_bit_storage(static_cast<gulong>(size - 1)) - 1;
+  const size_t step = static_cast<size_t>(1) << (exponent - 2);
+  return (size + step - 1) & ~(step - 1);
+}
+
+uint8_t* frame_buffer_pool_acquire(size_t size) {
+  const size_t capacity = frame_buffer_pool_capacity(size);
+  Pool* p = pool();
+  g_mutex_lock(&p->lock);
+  p->outstanding++;
+  p->trimming = FALSE;
+  // Newest first: its pages are the most likely to still be resident.
+  for (guint i = p->idle_count; i-- > 0;) {
+    if (p->idle[i].capacity == capacity) {
+      uint8_t* buffer = take_idle(p, i).buffer;
+      g_mutex_unlock(&p->lock);
+      return buffer;
+    }
+  }
+  g_mutex_unlock(&p->lock);
+  return allocate(capacity);
+}
+
+void frame_buffer_pool_release(uint8_t* buffer, size_t size) {
+  if (buffer == nullptr) return;
+  const size_t capacity = frame_buffer_pool_capacity(size);
+  Pool* p = pool();
+  g_mutex_lock(&p->lock);
+  p->outstanding--;
+  if (p->trimming || capacity > kMaxIdleBytes) {
+    g_mutex_unlock(&p->lock);
+    free(buffer);
+    return;
+  }
+
+  IdleBuffer evicted[kMaxIdleBuffers];
+  guint evicted_count = 0;
+  while (p->idle_count == kMaxIdleBuffers ||
+         p->idle_bytes + capacity > kMaxIdleBytes) {
+    evicted[evicted_count++] = take_idle(p, 0);
+  }
+  p->idle[p->idle_count++] = {buffer, capacity};
+  p->idle_bytes += capacity;
+  g_mutex_unlock(&p->lock);
+
+  for (guint i = 0; i < evicted_count; i++) {
+    free(evicted[i].buffer);
+  }
+}
+
+void frame_buffer_pool_trim() {
+  IdleBuffer freed[kMaxIdleBuffers];
+  Pool* p = pool();
+  g_mutex_lock(&p->lock);
+  const guint freed_count = p->idle_count;
+  memcpy(freed, p->idle, freed_count * sizeof(IdleBuffer));
+  p->idle_count = 0;
+  p->idle_bytes = 0;
+  p->trimming = p->outstanding > 0;
+  g_mutex_unlock(&p->lock);
+
+  for (guint i = 0; i < freed_count; i++) {
+    free(freed[i].buffer);
+  }
+}
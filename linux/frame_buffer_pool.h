@@ -0,0 +1,39 @@
+#ifndef FRAME_BUFFER_POOL_H_
+#define FRAME_BUFFER_POOL_H_
+
+#include <glib.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Process-wide pool of RGBA frame buffers shared by every player.
+//
+// Requests are rounded up to a size class (four per power of two, so at most
+// 25% slack) and idle buffers are handed back out by exact class. A player
+// switching renditions, or a new player opening at a common resolution,
+// usually gets memory that is already faulted in instead of fresh pages.
+//
+// Buffers are 64-byte aligned for the SIMD converter. Buffers of 2 MiB and
+// more are aligned to 2 MiB and advised as transparent huge pages, which the
+// kernel honours when THP is enabled in "madvise" or "always" mode.
+//
+// Idle memory is capped; releasing past the cap frees the least recently
+// released buffers. Thread safe.
+
+// Capacity of the size class that |size| bytes are rounded up to.
+size_t frame_buffer_pool_capacity(size_t size);
+
+// Returns a buffer of frame_buffer_pool_capacity(|size|) bytes. Contents are
+// undefined.
+uint8_t* frame_buffer_pool_acquire(size_t size);
+
+// Returns |buffer|, obtained from frame_buffer_pool_acquire(|size|) with the
+// same |size| class, to the pool. nullptr is ignored.
+void frame_buffer_pool_release(uint8_t* buffer, size_t size);
+
+// Frees every idle buffer. Buffers still in use are freed as they come back,
+// until the next frame_buffer_pool_acquire(). For memory pressure and for
+// when the last player is gone.
+void frame_buffer_pool_trim();
+
+#endif  // FRAME_BUFFER_POOL_H_
@@ -0,0 +1,33 @@
+#ifndef FRAME_COPY_H_
+#define FRAME_COPY_H_
+
+#include <glib.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Copies |height| rows of |row_bytes| from |src|, whose rows start
+// |src_stride| bytes apart, into |dst| packed at |row_bytes| per row.
+//
+// Frames too large to stay in cache are written with streaming stores
+// (AVX2, else SSE2), which skip reading the destination lines in first.
+// Smaller frames use memcpy, which glibc already dispatches to the CPU's
+// widest path and which leaves the frame cached for the texture upload.
+void frame_copy_rows(uint8_t* dst,
+                     const uint8_t* src,
+                     int src_stride,
+                     size_t row_bytes,
+                     int height);
+
+// frame_copy_rows() with streaming stores at any size, for benchmarks.
+// Falls back to memcpy where streaming stores are unavailable.
+void frame_copy_rows_streaming(uint8_t* dst,
+                               const uint8_t* src,
+                               int src_stride,
+                               size_t row_bytes,
+                               int height);
+
+// Name of the streaming path ("avx2", "sse2" or "memcpy").
+const char* frame_copy_backend_name();
+
+#endif  // FRAME_COPY_H_
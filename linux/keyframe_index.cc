@@ -0,0 +1,196 @@
+#include "keyframe_index.h"
+
+#include <gst/gst.h>
+
+#include "control_thread.h"
+
+struct _KeyframeIndex {
+  // Torn down on the control thread, which runs the bus watch.
+  GstElement* pipeline;  // urisourcebin ! parsebin ! fakesink per stream
+  GstElement* parse;
+  GSource* bus_watch;
+
+  // The indexed video pad, owned, and its segment to turn PTS into stream
+  // time. Streaming thread only.
+  GstPad* video_pad;
+  GstSegment segment;
+
+  GMutex lock;
+  GArray* positions;  // gint64 ms, ascending
+};
+
+// Inserts |ms| keeping the array sorted and free of duplicates. Keyframes
+// mostly arrive in order, so the search starts from the end. Lock held.
+static void insert_position(GArray* positions, gint64 ms) {
+  guint i = positions->len;
+  while (i > 0 && g_array_index(positions, gint64, i - 1) > ms) i--;
+  if (i > 0 && g_array_index(positions, gint64, i - 1) == ms) return;
+  g_array_insert_val(positions, i, ms);
+}
+
+static GstPadProbeReturn on_video_data(GstPad* pad,
+                                       GstPadProbeInfo* info,
+                                       gpointer user_data) {
+  auto* index = static_cast<KeyframeIndex*>(user_data);
+
+  if (info->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM) {
+    GstEvent* event = GST_PAD_PROBE_INFO_EVENT(info);
+    if (GST_EVENT_TYPE(event) == GST_EVENT_SEGMENT) {
+      gst_event_copy_segment(event, &index->segment);
+    }
+    return GST_PAD_PROBE_OK;
+  }
+
+  GstBuffer* buffer = GST_PAD_PROBE_INFO_BUFFER(info);
+  if (GST_BUFFER_FLAG_IS_SET(buffer, GST_BUFFER_FLAG_DELTA_UNIT)) {
+    return GST_PAD_PROBE_OK;
+  }
+  GstClockTime pts = GST_BUFFER_PTS_IS_VALID(buffer) ? GST_BUFFER_PTS(buffer)
+                                                     : GST_BUFFER_DTS(buffer);
+  if (!GST_CLOCK_TIME_IS_VALID(pts) ||
+      index->segment.format != GST_FORMAT_TIME) {
+    return GST_PAD_PROBE_OK;
+  }
+  guint64 stream_time =
+      gst_segment_to_stream_time(&index->segment, GST_FORMAT_TIME, pts);
+  if (!GST_CLOCK_TIME_IS_VALID(stream_time)) return GST_PAD_PROBE_OK;
+
+  g_mutex_lock(&index->lock);
+  insert_position(index->positions,
+                  static_cast<gint64>(stream_time / GST_MSECOND));
+  g_mutex_unlock(&index->lock);
+  return GST_PAD_PROBE_OK;
+}
+
+// Every parsed stream needs a sink or parsebin stops with not-linked; only
+// the first video stream is watched.
+static void on_parse_pad_added(GstElement* element,
+                               GstPad* pad,
+                               gpointer user_data) {
+  auto* index = static_cast<KeyframeIndex*>(user_data);
+
+  GstElement* sink = gst_element_factory_make("fakesink", nullptr);
+  g_object_set(sink, "sync", FALSE, "async", FALSE, nullptr);
+  gst_bin_add(GST_BIN(index->pipeline), sink);
+  gst_element_sync_state_with_parent(sink);
+  GstPad* sink_pad = gst_element_get_static_pad(sink, "sink");
+  gst_pad_link(pad, sink_pad);
+  gst_object_unref(sink_pad);
+
+  GstCaps* caps = gst_pad_get_current_caps(pad);
+  if (caps == nullptr) caps = gst_pad_query_caps(pad, nullptr);
+  gboolean is_video =
+      caps != nullptr && gst_caps_get_size(caps) > 0 &&
+      g_str_has_prefix(gst_structure_get_name(gst_caps_get_structure(caps, 0)),
+                       "video/");
+  if (caps != nullptr) gst_caps_unref(caps);
+
+  if (is_video && index->video_pad == nullptr) {
+    index->video_pad = GST_PAD(gst_object_ref(pad));
+    gst_pad_add_probe(pad,
+                      static_cast<GstPadProbeType>(
+                          GST_PAD_PROBE_TYPE_BUFFER |
+                          GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM),
+                      on_video_data, index, nullptr);
+  }
+}
+
+static void on_source_pad_added(GstElement* element,
+                                GstPad* pad,
+                                gpointer user_data) {
+  auto* index = static_cast<KeyframeIndex*>(user_data);
+  GstPad* sink_pad = gst_element_get_static_pad(index->parse, "sink");
+  if (!gst_pad_is_linked(sink_pad)) gst_pad_link(pad, sink_pad);
+  gst_object_unref(sink_pad);
+}
+
+// Control thread.
+static void stop_pipeline(KeyframeIndex* index) {
+  if (index->pipeline == nullptr) return;
+  gst_element_set_state(index->pipeline, GST_STATE_NULL);
+  if (index->bus_watch != nullptr) {
+    g_source_destroy(index->bus_watch);
+    g_source_unref(index->bus_watch);
+    index->bus_watch = nullptr;
+  }
+  gst_object_unref(index->pipeline);
+  index->pipeline = nullptr;
+  index->parse = nullptr;
+}
+
+static gboolean on_bus_message(GstBus* bus,
+                               GstMessage* message,
+                               gpointer user_data) {
+  auto* index = static_cast<KeyframeIndex*>(user_data);
+  switch (GST_MESSAGE_TYPE(message)) {
+    case GST_MESSAGE_ERROR:
+      g_warning("keyframe_index: scan failed, index is partial");
+      // fall through
+    case GST_MESSAGE_EOS:
+      stop_pipeline(index);
+      return G_SOURCE_REMOVE;
+    default:
+      return G_SOURCE_CONTINUE;
+  }
+}
+
+KeyframeIndex* keyframe_index_new(const gchar* uri) {
+  if (uri == nullptr || !gst_uri_has_protocol(uri, "file")) return nullptr;
+
+  auto* index = g_new0(KeyframeIndex, 1);
+  g_mutex_init(&index->lock);
+  index->positions = g_array_new(FALSE, FALSE, sizeof(gint64));
+  gst_segment_init(&index->segment, GST_FORMAT_UNDEFINED);
+
+  GstElement* source = gst_element_factory_make("urisourcebin", nullptr);
+  index->parse = gst_element_factory_make("parsebin", nullptr);
+  if (source == nullptr || index->parse == nullptr) {
+    // GStreamer older than 1.10.
+    if (source != nullptr) gst_object_unref(source);
+    if (index->parse != nullptr) gst_object_unref(index->parse);
+    index->parse = nullptr;
+    return index;
+  }
+
+  index->pipeline = gst_pipeline_new("keyframe-index");
+  g_object_set(source, "uri", uri, nullptr);
+  gst_bin_add_many(GST_BIN(index->pipeline), source, index->parse, nullptr);
+  g_signal_connect(source, "pad-added", G_CALLBACK(on_source_pad_added),
+                   index);
+  g_signal_connect(index->parse, "pad-added", G_CALLBACK(on_parse_pad_added),
+                   index);
+
+  // On the control thread, like the player bus watches, so the scan ends on
+  // time while the main thread is busy.
+  GstBus* bus = gst_element_get_bus(index->pipeline);
+  index->bus_watch = gst_bus_create_watch(bus);
+  gst_object_unref(bus);
+  g_source_set_callback(index->bus_watch,
+                        reinterpret_cast<GSourceFunc>(on_bus_message), index,
+                        nullptr);
+  g_source_attach(index->bus_watch, control_thread_get_context());
+
+  if (gst_element_set_state(index->pipeline, GST_STATE_PLAYING) ==
+      GST_STATE_CHANGE_FAILURE) {
+    control_thread_run_sync([index] { stop_pipeline(index); });
+  }
+  return index;
+}
+
+GArray* keyframe_index_get_positions(KeyframeIndex* index) {
+  g_mutex_lock(&index->lock);
+  GArray* copy = g_array_sized_new(FALSE, FALSE, sizeof(gint64),
+                                   index->positions->len);
+  g_array_append_vals(copy, index->positions->data, index->positions->len);
+  g_mutex_unlock(&index->lock);
+  return copy;
+}
+
+void keyframe_index_free(KeyframeIndex* index) {
+  if (index == nullptr) return;
+  control_thread_run_sync([index] { stop_pipeline(index); });
+  if (index->video_pad != nullptr) gst_object_unref(index->video_pad);
+  g_array_unref(index->positions);
+  g_mutex_clear(&index->lock);
+  g_free(index);
+}
@@ -0,0 +1,27 @@
+#ifndef KEYFRAME_INDEX_H_
+#define KEYFRAME_INDEX_H_
+
+#include <glib.h>
+
+// Keyframe positions of a local media file.
+//
+// The file is demuxed and parsed, but not decoded, on a private pipeline
+// that starts when the index is created and tears itself down at EOS, from
+// its bus watch on the control thread.
+// Positions found so far can be read at any time, so callers get a partial
+// index while a long file is still being scanned. Only the first video
+// stream is indexed.
+typedef struct _KeyframeIndex KeyframeIndex;
+
+// Starts scanning |uri|. Returns nullptr for anything but file:// URIs:
+// indexing a network source would download all of it.
+KeyframeIndex* keyframe_index_new(const gchar* uri);
+
+// Returns a new array of gint64 keyframe stream times in milliseconds,
+// ascending.
+GArray* keyframe_index_get_positions(KeyframeIndex* index);
+
+// Stops a running scan and frees the index.
+void keyframe_index_free(KeyframeIndex* index);
+
+#endif  // KEYFRAME_INDEX_H_
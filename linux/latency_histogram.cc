@@ -0,0 +1,53 @@
+#include "latency_histogram.h"
+
+#include <cmath>
+
+namespace {
+
+constexpr int kSubBucketBits = 3;
+constexpr gint64 kSubBuckets = 1 << kSubBucketBits;
+
+int bucket_index(gint64 value) {
+  if (value < kSubBuckets) return static_cast<int>(MAX(value, 0));
+  // Position of the top bit picks the power of two, the next three bits the
+  // sub-bucket within it.
+  int exponent = static_cast<int>(g_bit_storage(static_cast<gulong>(value))) - 1;
+  int shift = exponent - kSubBucketBits;
+  int index = static_cast<int>(kSubBuckets) * (shift + 1) +
+              static_cast<int>((value >> shift) & (kSubBuckets - 1));
+  return MIN(index, LATENCY_HISTOGRAM_BUCKETS - 1);
+}
+
+gint64 bucket_midpoint(int index) {
+  if (index < kSubBuckets) return index;
+  int shift = index / static_cast<int>(kSubBuckets) - 1;
+  gint64 lower = (kSubBuckets + index % kSubBuckets) << shift;
+  return lower + ((static_cast<gint64>(1) << shift) >> 1);
+}
+
+}  // namespace
+
+void latency_histogram_record(LatencyHistogram* histogram, gint64 value_us) {
+  g_atomic_int_inc(&histogram->buckets[bucket_index(value_us)]);
+}
+
+gint64 latency_histogram_percentile(LatencyHistogram* histogram,
+                                    double percentile) {
+  gint counts[LATENCY_HISTOGRAM_BUCKETS];
+  gint64 total = 0;
+  for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++) {
+    counts[i] = g_atomic_int_get(&histogram->buckets[i]);
+    total += counts[i];
+  }
+  if (total == 0) return 0;
+
+  percentile = CLAMP(percentile, 0.0, 100.0);
+  gint64 rank = MAX(static_cast<gint64>(std::ceil(percentile / 100.0 * total)),
+                    static_cast<gint64>(1));
+  gint64 seen = 0;
+  for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++) {
+    seen += counts[i];
+    if (seen >= rank) return bucket_midpoint(i);
+  }
+  return bucket_midpoint(LATENCY_HISTOGRAM_BUCKETS - 1);
+}
@@ -0,0 +1,26 @@
+#ifndef LATENCY_HISTOGRAM_H_
+#define LATENCY_HISTOGRAM_H_
+
+#include <glib.h>
+
+// Log-linear buckets: one per microsecond below 8 us, then each power of two
+// split into 8 sub-buckets (at most 12.5% error), topping out above a minute.
+#define LATENCY_HISTOGRAM_BUCKETS 192
+
+// Histogram of durations in microseconds. One thread records and any thread
+// reads without locking: a sample is a single atomic increment and readers
+// sum a snapshot of the buckets. Zero-initialised memory is an empty
+// histogram.
+typedef struct {
+  gint buckets[LATENCY_HISTOGRAM_BUCKETS];
+} LatencyHistogram;
+
+// Records one sample. Negative values count as 0.
+void latency_histogram_record(LatencyHistogram* histogram, gint64 value_us);
+
+// Value below which |percentile| (0-100) of the samples fall, reported as the
+// midpoint of its bucket. 0 when nothing has been recorded.
+gint64 latency_histogram_percentile(LatencyHistogram* histogram,
+                                    double percentile);
+
+#endif  // LATENCY_HISTOGRAM_H_
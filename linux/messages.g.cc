@@ -338,7 +338,7 @@ AvPlayerMediaMetadataMessage* av_player_media_metadata_request_get_metadata(AvPl
 static FlValue* av_player_media_metadata_request_to_list(AvPlayerMediaMetadataRequest* self) {
   FlValue* values = fl_value_new_list();
   fl_value_append_take(values, fl_value_new_int(self->player_id));
-  fl_value_append_take(values, fl_value_new_custom_object(131, G_OBJECT(self->metadata)));
+  fl_value_append_take(values, fl_value_new_custom_object(132, G_OBJECT(self->metadata)));
   return values;
 }
 
@@ -513,7 +513,7 @@ AvPlayerAbrConfigMessage* av_player_set_abr_config_request_get_config(AvPlayerSe
 static FlValue* av_player_set_abr_config_request_to_list(AvPlayerSetAbrConfigRequest* self) {
   FlValue* values = fl_value_new_list();
   fl_value_append_take(values, fl_value_new_int(self->player_id));
-  fl_value_append_take(values, fl_value_new_custom_object(134, G_OBJECT(self->config)));
+  fl_value_append_take(values, fl_value_new_custom_object(135, G_OBJECT(self->config)));
   return values;
 }
 
@@ -742,6 +742,364 @@ static AvPlayerSelectSubtitleTrackRequest* av_player_select_subtitle_track_reque
   return av_player_select_subtitle_track_request_new(player_id, track_id);
 }
 
+struct _AvPlayerRenderStatsMessage {
+  GObject parent_instance;
+
+  int64_t frames_decoded;
+  int64_t frames_presented;
+  int64_t frames_dropped;
+  int64_t conversion_p50_us;
+  int64_t conversion_p95_us;
+  int64_t conversion_p99_us;
+  int64_t copy_p50_us;
+  int64_t copy_p95_us;
+  int64_t copy_p99_us;
+  int64_t lateness_p50_us;
+  int64_t lateness_p95_us;
+  int64_t lateness_p99_us;
+  int64_t audio_filter_p50_us;
+  int64_t audio_filter_p95_us;
+  int64_t audio_filter_p99_us;
+};
+
+G_DEFINE_TYPE(AvPlayerRenderStatsMessage, av_player_render_stats_message, G_TYPE_OBJECT)
+
+static void av_player_render_stats_message_dispose(GObject* object) {
+  G_OBJECT_CLASS(av_player_render_stats_message_parent_class)->dispose(object);
+}
+
+static void av_player_render_stats_message_init(AvPlayerRenderStatsMessage* self) {
+}
+
+static void av_player_render_stats_message_class_init(AvPlayerRenderStatsMessageClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_render_stats_message_dispose;
+}
+
+AvPlayerRenderStatsMessage* av_player_render_stats_message_new(int64_t frames_decoded, int64_t frames_presented, int64_t frames_dropped, int64_t conversion_p50_us, int64_t conversion_p95_us, int64_t conversion_p99_us, int64_t copy_p50_us, int64_t copy_p95_us, int64_t copy_p99_us, int64_t lateness_p50_us, int64_t lateness_p95_us, int64_t lateness_p99_us, int64_t audio_filter_p50_us, int64_t audio_filter_p95_us, int64_t audio_filter_p99_us) {
+  AvPlayerRenderStatsMessage* self = AV_PLAYER_RENDER_STATS_MESSAGE(g_object_new(av_player_render_stats_message_get_type(), nullptr));
+  self->frames_decoded = frames_decoded;
+  self->frames_presented = frames_presented;
+  self->frames_dropped = frames_dropped;
+  self->conversion_p50_us = conversion_p50_us;
+  self->conversion_p95_us = conversion_p95_us;
+  self->conversion_p99_us = conversion_p99_us;
+  self->copy_p50_us = copy_p50_us;
+  self->copy_p95_us = copy_p95_us;
+  self->copy_p99_us = copy_p99_us;
+  self->lateness_p50_us = lateness_p50_us;
+  self->lateness_p95_us = lateness_p95_us;
+  self->lateness_p99_us = lateness_p99_us;
+  self->audio_filter_p50_us = audio_filter_p50_us;
+  self->audio_filter_p95_us = audio_filter_p95_us;
+  self->audio_filter_p99_us = audio_filter_p99_us;
+  return self;
+}
+
+int64_t av_player_render_stats_message_get_frames_decoded(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->frames_decoded;
+}
+
+int64_t av_player_render_stats_message_get_frames_presented(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->frames_presented;
+}
+
+int64_t av_player_render_stats_message_get_frames_dropped(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->frames_dropped;
+}
+
+int64_t av_player_render_stats_message_get_conversion_p50_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->conversion_p50_us;
+}
+
+int64_t av_player_render_stats_message_get_conversion_p95_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->conversion_p95_us;
+}
+
+int64_t av_player_render_stats_message_get_conversion_p99_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->conversion_p99_us;
+}
+
+int64_t av_player_render_stats_message_get_copy_p50_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->copy_p50_us;
+}
+
+int64_t av_player_render_stats_message_get_copy_p95_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->copy_p95_us;
+}
+
+int64_t av_player_render_stats_message_get_copy_p99_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->copy_p99_us;
+}
+
+int64_t av_player_render_stats_message_get_lateness_p50_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->lateness_p50_us;
+}
+
+int64_t av_player_render_stats_message_get_lateness_p95_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->lateness_p95_us;
+}
+
+int64_t av_player_render_stats_message_get_lateness_p99_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->lateness_p99_us;
+}
+
+int64_t av_player_render_stats_message_get_audio_filter_p50_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->audio_filter_p50_us;
+}
+
+int64_t av_player_render_stats_message_get_audio_filter_p95_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->audio_filter_p95_us;
+}
+
+int64_t av_player_render_stats_message_get_audio_filter_p99_us(AvPlayerRenderStatsMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_RENDER_STATS_MESSAGE(self), 0);
+  return self->audio_filter_p99_us;
+}
+
+static FlValue* av_player_render_stats_message_to_list(AvPlayerRenderStatsMessage* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->frames_decoded));
+  fl_value_append_take(values, fl_value_new_int(self->frames_presented));
+  fl_value_append_take(values, fl_value_new_int(self->frames_dropped));
+  fl_value_append_take(values, fl_value_new_int(self->conversion_p50_us));
+  fl_value_append_take(values, fl_value_new_int(self->conversion_p95_us));
+  fl_value_append_take(values, fl_value_new_int(self->conversion_p99_us));
+  fl_value_append_take(values, fl_value_new_int(self->copy_p50_us));
+  fl_value_append_take(values, fl_value_new_int(self->copy_p95_us));
+  fl_value_append_take(values, fl_value_new_int(self->copy_p99_us));
+  fl_value_append_take(values, fl_value_new_int(self->lateness_p50_us));
+  fl_value_append_take(values, fl_value_new_int(self->lateness_p95_us));
+  fl_value_append_take(values, fl_value_new_int(self->lateness_p99_us));
+  fl_value_append_take(values, fl_value_new_int(self->audio_filter_p50_us));
+  fl_value_append_take(values, fl_value_new_int(self->audio_filter_p95_us));
+  fl_value_append_take(values, fl_value_new_int(self->audio_filter_p99_us));
+  return values;
+}
+
+static AvPlayerRenderStatsMessage* av_player_render_stats_message_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t frames_decoded = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t frames_presented = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t frames_dropped = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t conversion_p50_us = fl_value_get_int(value3);
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  int64_t conversion_p95_us = fl_value_get_int(value4);
+  FlValue* value5 = fl_value_get_list_value(values, 5);
+  int64_t conversion_p99_us = fl_value_get_int(value5);
+  FlValue* value6 = fl_value_get_list_value(values, 6);
+  int64_t copy_p50_us = fl_value_get_int(value6);
+  FlValue* value7 = fl_value_get_list_value(values, 7);
+  int64_t copy_p95_us = fl_value_get_int(value7);
+  FlValue* value8 = fl_value_get_list_value(values, 8);
+  int64_t copy_p99_us = fl_value_get_int(value8);
+  FlValue* value9 = fl_value_get_list_value(values, 9);
+  int64_t lateness_p50_us = fl_value_get_int(value9);
+  FlValue* value10 = fl_value_get_list_value(values, 10);
+  int64_t lateness_p95_us = fl_value_get_int(value10);
+  FlValue* value11 = fl_value_get_list_value(values, 11);
+  int64_t lateness_p99_us = fl_value_get_int(value11);
+  FlValue* value12 = fl_value_get_list_value(values, 12);
+  int64_t audio_filter_p50_us = fl_value_get_int(value12);
+  FlValue* value13 = fl_value_get_list_value(values, 13);
+  int64_t audio_filter_p95_us = fl_value_get_int(value13);
+  FlValue* value14 = fl_value_get_list_value(values, 14);
+  int64_t audio_filter_p99_us = fl_value_get_int(value14);
+  return av_player_render_stats_message_new(frames_decoded, frames_presented, frames_dropped, conversion_p50_us, conversion_p95_us, conversion_p99_us, copy_p50_us, copy_p95_us, copy_p99_us, lateness_p50_us, lateness_p95_us, lateness_p99_us, audio_filter_p50_us, audio_filter_p95_us, audio_filter_p99_us);
+}
+
+struct _AvPlayerCreateResultMessage {
+  GObject parent_instance;
+
+  int64_t player_id;
+  int64_t create_latency_us;
+};
+
+G_DEFINE_TYPE(AvPlayerCreateResultMessage, av_player_create_result_message, G_TYPE_OBJECT)
+
+static void av_player_create_result_message_dispose(GObject* object) {
+  G_OBJECT_CLASS(av_player_create_result_message_parent_class)->dispose(object);
+}
+
+static void av_player_create_result_message_init(AvPlayerCreateResultMessage* self) {
+}
+
+static void av_player_create_result_message_class_init(AvPlayerCreateResultMessageClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_create_result_message_dispose;
+}
+
+AvPlayerCreateResultMessage* av_player_create_result_message_new(int64_t player_id, int64_t create_latency_us) {
+  AvPlayerCreateResultMessage* self = AV_PLAYER_CREATE_RESULT_MESSAGE(g_object_new(av_player_create_result_message_get_type(), nullptr));
+  self->player_id = player_id;
+  self->create_latency_us = create_latency_us;
+  return self;
+}
+
+int64_t av_player_create_result_message_get_player_id(AvPlayerCreateResultMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_CREATE_RESULT_MESSAGE(self), 0);
+  return self->player_id;
+}
+
+int64_t av_player_create_result_message_get_create_latency_us(AvPlayerCreateResultMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_CREATE_RESULT_MESSAGE(self), 0);
+  return self->create_latency_us;
+}
+
+static FlValue* av_player_create_result_message_to_list(AvPlayerCreateResultMessage* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->player_id));
+  fl_value_append_take(values, fl_value_new_int(self->create_latency_us));
+  return values;
+}
+
+static AvPlayerCreateResultMessage* av_player_create_result_message_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t create_latency_us = fl_value_get_int(value1);
+  return av_player_create_result_message_new(player_id, create_latency_us);
+}
+
+struct _AvPlayerClockAnchorMessage {
+  GObject parent_instance;
+
+  int64_t player_id;
+  int64_t position_ms;
+  double rate;
+  int64_t timestamp_us;
+};
+
+G_DEFINE_TYPE(AvPlayerClockAnchorMessage, av_player_clock_anchor_message, G_TYPE_OBJECT)
+
+static void av_player_clock_anchor_message_dispose(GObject* object) {
+  G_OBJECT_CLASS(av_player_clock_anchor_message_parent_class)->dispose(object);
+}
+
+static void av_player_clock_anchor_message_init(AvPlayerClockAnchorMessage* self) {
+}
+
+static void av_player_clock_anchor_message_class_init(AvPlayerClockAnchorMessageClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_clock_anchor_message_dispose;
+}
+
+AvPlayerClockAnchorMessage* av_player_clock_anchor_message_new(int64_t player_id, int64_t position_ms, double rate, int64_t timestamp_us) {
+  AvPlayerClockAnchorMessage* self = AV_PLAYER_CLOCK_ANCHOR_MESSAGE(g_object_new(av_player_clock_anchor_message_get_type(), nullptr));
+  self->player_id = player_id;
+  self->position_ms = position_ms;
+  self->rate = rate;
+  self->timestamp_us = timestamp_us;
+  return self;
+}
+
+int64_t av_player_clock_anchor_message_get_player_id(AvPlayerClockAnchorMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_CLOCK_ANCHOR_MESSAGE(self), 0);
+  return self->player_id;
+}
+
+int64_t av_player_clock_anchor_message_get_position_ms(AvPlayerClockAnchorMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_CLOCK_ANCHOR_MESSAGE(self), 0);
+  return self->position_ms;
+}
+
+double av_player_clock_anchor_message_get_rate(AvPlayerClockAnchorMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_CLOCK_ANCHOR_MESSAGE(self), 0.0);
+  return self->rate;
+}
+
+int64_t av_player_clock_anchor_message_get_timestamp_us(AvPlayerClockAnchorMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_CLOCK_ANCHOR_MESSAGE(self), 0);
+  return self->timestamp_us;
+}
+
+static FlValue* av_player_clock_anchor_message_to_list(AvPlayerClockAnchorMessage* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->player_id));
+  fl_value_append_take(values, fl_value_new_int(self->position_ms));
+  fl_value_append_take(values, fl_value_new_float(self->rate));
+  fl_value_append_take(values, fl_value_new_int(self->timestamp_us));
+  return values;
+}
+
+static AvPlayerClockAnchorMessage* av_player_clock_anchor_message_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t position_ms = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  double rate = fl_value_get_float(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t timestamp_us = fl_value_get_int(value3);
+  return av_player_clock_anchor_message_new(player_id, position_ms, rate, timestamp_us);
+}
+
+struct _AvPlayerStateUpdateMessage {
+  GObject parent_instance;
+
+  int64_t player_id;
+  int64_t buffered_ms;
+};
+
+G_DEFINE_TYPE(AvPlayerStateUpdateMessage, av_player_state_update_message, G_TYPE_OBJECT)
+
+static void av_player_state_update_message_dispose(GObject* object) {
+  G_OBJECT_CLASS(av_player_state_update_message_parent_class)->dispose(object);
+}
+
+static void av_player_state_update_message_init(AvPlayerStateUpdateMessage* self) {
+}
+
+static void av_player_state_update_message_class_init(AvPlayerStateUpdateMessageClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_state_update_message_dispose;
+}
+
+AvPlayerStateUpdateMessage* av_player_state_update_message_new(int64_t player_id, int64_t buffered_ms) {
+  AvPlayerStateUpdateMessage* self = AV_PLAYER_STATE_UPDATE_MESSAGE(g_object_new(av_player_state_update_message_get_type(), nullptr));
+  self->player_id = player_id;
+  self->buffered_ms = buffered_ms;
+  return self;
+}
+
+int64_t av_player_state_update_message_get_player_id(AvPlayerStateUpdateMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_STATE_UPDATE_MESSAGE(self), 0);
+  return self->player_id;
+}
+
+int64_t av_player_state_update_message_get_buffered_ms(AvPlayerStateUpdateMessage* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_STATE_UPDATE_MESSAGE(self), 0);
+  return self->buffered_ms;
+}
+
+static FlValue* av_player_state_update_message_to_list(AvPlayerStateUpdateMessage* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->player_id));
+  fl_value_append_take(values, fl_value_new_int(self->buffered_ms));
+  return values;
+}
+
+static AvPlayerStateUpdateMessage* av_player_state_update_message_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t buffered_ms = fl_value_get_int(value1);
+  return av_player_state_update_message_new(player_id, buffered_ms);
+}
+
 struct _AvPlayerMessageCodec {
   FlStandardMessageCodec parent_instance;
 
@@ -755,92 +1113,136 @@ static gboolean av_player_message_codec_write_av_player_source_type(FlStandardMe
   return fl_standard_message_codec_write_value(codec, buffer, value, error);
 }
 
-static gboolean av_player_message_codec_write_av_player_video_source_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerVideoSourceMessage* value, GError** error) {
+static gboolean av_player_message_codec_write_av_player_seek_mode(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
   uint8_t type = 130;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean av_player_message_codec_write_av_player_video_source_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerVideoSourceMessage* value, GError** error) {
+  uint8_t type = 131;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_video_source_message_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_media_metadata_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerMediaMetadataMessage* value, GError** error) {
-  uint8_t type = 131;
+  uint8_t type = 132;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_media_metadata_message_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_enter_pip_request(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerEnterPipRequest* value, GError** error) {
-  uint8_t type = 132;
+  uint8_t type = 133;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_enter_pip_request_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_media_metadata_request(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerMediaMetadataRequest* value, GError** error) {
-  uint8_t type = 133;
+  uint8_t type = 134;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_media_metadata_request_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_abr_config_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerAbrConfigMessage* value, GError** error) {
-  uint8_t type = 134;
+  uint8_t type = 135;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_abr_config_message_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_set_abr_config_request(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerSetAbrConfigRequest* value, GError** error) {
-  uint8_t type = 135;
+  uint8_t type = 136;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_set_abr_config_request_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_decoder_info_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerDecoderInfoMessage* value, GError** error) {
-  uint8_t type = 136;
+  uint8_t type = 137;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_decoder_info_message_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_subtitle_track_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerSubtitleTrackMessage* value, GError** error) {
-  uint8_t type = 137;
+  uint8_t type = 138;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_subtitle_track_message_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
 static gboolean av_player_message_codec_write_av_player_select_subtitle_track_request(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerSelectSubtitleTrackRequest* value, GError** error) {
-  uint8_t type = 138;
+  uint8_t type = 139;
   g_byte_array_append(buffer, &type, sizeof(uint8_t));
   g_autoptr(FlValue) values = av_player_select_subtitle_track_request_to_list(value);
   return fl_standard_message_codec_write_value(codec, buffer, values, error);
 }
 
+static gboolean av_player_message_codec_write_av_player_render_stats_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerRenderStatsMessage* value, GError** error) {
+  uint8_t type = 140;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = av_player_render_stats_message_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean av_player_message_codec_write_av_player_create_result_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerCreateResultMessage* value, GError** error) {
+  uint8_t type = 141;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = av_player_create_result_message_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean av_player_message_codec_write_av_player_clock_anchor_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerClockAnchorMessage* value, GError** error) {
+  uint8_t type = 142;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = av_player_clock_anchor_message_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean av_player_message_codec_write_av_player_state_update_message(FlStandardMessageCodec* codec, GByteArray* buffer, AvPlayerStateUpdateMessage* value, GError** error) {
+  uint8_t type = 143;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = av_player_state_update_message_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
 static gboolean av_player_message_codec_write_value(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
   if (fl_value_get_type(value) == FL_VALUE_TYPE_CUSTOM) {
     switch (fl_value_get_custom_type(value)) {
       case 129:
         return av_player_message_codec_write_av_player_source_type(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
       case 130:
-        return av_player_message_codec_write_av_player_video_source_message(codec, buffer, AV_PLAYER_VIDEO_SOURCE_MESSAGE(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_seek_mode(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
       case 131:
-        return av_player_message_codec_write_av_player_media_metadata_message(codec, buffer, AV_PLAYER_MEDIA_METADATA_MESSAGE(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_video_source_message(codec, buffer, AV_PLAYER_VIDEO_SOURCE_MESSAGE(fl_value_get_custom_value_object(value)), error);
       case 132:
-        return av_player_message_codec_write_av_player_enter_pip_request(codec, buffer, AV_PLAYER_ENTER_PIP_REQUEST(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_media_metadata_message(codec, buffer, AV_PLAYER_MEDIA_METADATA_MESSAGE(fl_value_get_custom_value_object(value)), error);
       case 133:
-        return av_player_message_codec_write_av_player_media_metadata_request(codec, buffer, AV_PLAYER_MEDIA_METADATA_REQUEST(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_enter_pip_request(codec, buffer, AV_PLAYER_ENTER_PIP_REQUEST(fl_value_get_custom_value_object(value)), error);
       case 134:
-        return av_player_message_codec_write_av_player_abr_config_message(codec, buffer, AV_PLAYER_ABR_CONFIG_MESSAGE(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_media_metadata_request(codec, buffer, AV_PLAYER_MEDIA_METADATA_REQUEST(fl_value_get_custom_value_object(value)), error);
       case 135:
-        return av_player_message_codec_write_av_player_set_abr_config_request(codec, buffer, AV_PLAYER_SET_ABR_CONFIG_REQUEST(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_abr_config_message(codec, buffer, AV_PLAYER_ABR_CONFIG_MESSAGE(fl_value_get_custom_value_object(value)), error);
       case 136:
-        return av_player_message_codec_write_av_player_decoder_info_message(codec, buffer, AV_PLAYER_DECODER_INFO_MESSAGE(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_set_abr_config_request(codec, buffer, AV_PLAYER_SET_ABR_CONFIG_REQUEST(fl_value_get_custom_value_object(value)), error);
       case 137:
-        return av_player_message_codec_write_av_player_subtitle_track_message(codec, buffer, AV_PLAYER_SUBTITLE_TRACK_MESSAGE(fl_value_get_custom_value_object(value)), error);
+        return av_player_message_codec_write_av_player_decoder_info_message(codec, buffer, AV_PLAYER_DECODER_INFO_MESSAGE(fl_value_get_custom_value_object(value)), error);
       case 138:
+        return av_player_message_codec_write_av_player_subtitle_track_message(codec, buffer, AV_PLAYER_SUBTITLE_TRACK_MESSAGE(fl_value_get_custom_value_object(value)), error);
+      case 139:
         return av_player_message_codec_write_av_player_select_subtitle_track_request(codec, buffer, AV_PLAYER_SELECT_SUBTITLE_TRACK_REQUEST(fl_value_get_custom_value_object(value)), error);
+      case 140:
+        return av_player_message_codec_write_av_player_render_stats_message(codec, buffer, AV_PLAYER_RENDER_STATS_MESSAGE(fl_value_get_custom_value_object(value)), error);
+      case 141:
+        return av_player_message_codec_write_av_player_create_result_message(codec, buffer, AV_PLAYER_CREATE_RESULT_MESSAGE(fl_value_get_custom_value_object(value)), error);
+      case 142:
+        return av_player_message_codec_write_av_player_clock_anchor_message(codec, buffer, AV_PLAYER_CLOCK_ANCHOR_MESSAGE(fl_value_get_custom_value_object(value)), error);
+      case 143:
+        return av_player_message_codec_write_av_player_state_update_message(codec, buffer, AV_PLAYER_STATE_UPDATE_MESSAGE(fl_value_get_custom_value_object(value)), error);
     }
   }
 
@@ -851,6 +1253,10 @@ static FlValue* av_player_message_codec_read_av_player_source_type(FlStandardMes
   return fl_value_new_custom(129, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
 }
 
+static FlValue* av_player_message_codec_read_av_player_seek_mode(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(130, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
 static FlValue* av_player_message_codec_read_av_player_video_source_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
   g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
   if (values == nullptr) {
@@ -863,7 +1269,7 @@ static FlValue* av_player_message_codec_read_av_player_video_source_message(FlSt
     return nullptr;
   }
 
-  return fl_value_new_custom_object(130, G_OBJECT(value));
+  return fl_value_new_custom_object(131, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_media_metadata_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -878,7 +1284,7 @@ static FlValue* av_player_message_codec_read_av_player_media_metadata_message(Fl
     return nullptr;
   }
 
-  return fl_value_new_custom_object(131, G_OBJECT(value));
+  return fl_value_new_custom_object(132, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_enter_pip_request(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -893,7 +1299,7 @@ static FlValue* av_player_message_codec_read_av_player_enter_pip_request(FlStand
     return nullptr;
   }
 
-  return fl_value_new_custom_object(132, G_OBJECT(value));
+  return fl_value_new_custom_object(133, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_media_metadata_request(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -908,7 +1314,7 @@ static FlValue* av_player_message_codec_read_av_player_media_metadata_request(Fl
     return nullptr;
   }
 
-  return fl_value_new_custom_object(133, G_OBJECT(value));
+  return fl_value_new_custom_object(134, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_abr_config_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -923,7 +1329,7 @@ static FlValue* av_player_message_codec_read_av_player_abr_config_message(FlStan
     return nullptr;
   }
 
-  return fl_value_new_custom_object(134, G_OBJECT(value));
+  return fl_value_new_custom_object(135, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_set_abr_config_request(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -938,7 +1344,7 @@ static FlValue* av_player_message_codec_read_av_player_set_abr_config_request(Fl
     return nullptr;
   }
 
-  return fl_value_new_custom_object(135, G_OBJECT(value));
+  return fl_value_new_custom_object(136, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_decoder_info_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -953,7 +1359,7 @@ static FlValue* av_player_message_codec_read_av_player_decoder_info_message(FlSt
     return nullptr;
   }
 
-  return fl_value_new_custom_object(136, G_OBJECT(value));
+  return fl_value_new_custom_object(137, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_subtitle_track_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -968,7 +1374,7 @@ static FlValue* av_player_message_codec_read_av_player_subtitle_track_message(Fl
     return nullptr;
   }
 
-  return fl_value_new_custom_object(137, G_OBJECT(value));
+  return fl_value_new_custom_object(138, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_av_player_select_subtitle_track_request(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
@@ -983,7 +1389,67 @@ static FlValue* av_player_message_codec_read_av_player_select_subtitle_track_req
     return nullptr;
   }
 
-  return fl_value_new_custom_object(138, G_OBJECT(value));
+  return fl_value_new_custom_object(139, G_OBJECT(value));
+}
+
+static FlValue* av_player_message_codec_read_av_player_render_stats_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(AvPlayerRenderStatsMessage) value = av_player_render_stats_message_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(140, G_OBJECT(value));
+}
+
+static FlValue* av_player_message_codec_read_av_player_create_result_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(AvPlayerCreateResultMessage) value = av_player_create_result_message_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(141, G_OBJECT(value));
+}
+
+static FlValue* av_player_message_codec_read_av_player_clock_anchor_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(AvPlayerClockAnchorMessage) value = av_player_clock_anchor_message_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(142, G_OBJECT(value));
+}
+
+static FlValue* av_player_message_codec_read_av_player_state_update_message(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(AvPlayerStateUpdateMessage) value = av_player_state_update_message_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(143, G_OBJECT(value));
 }
 
 static FlValue* av_player_message_codec_read_value_of_type(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, int type, GError** error) {
@@ -991,23 +1457,33 @@ static FlValue* av_player_message_codec_read_value_of_type(FlStandardMessageCode
     case 129:
       return av_player_message_codec_read_av_player_source_type(codec, buffer, offset, error);
     case 130:
-      return av_player_message_codec_read_av_player_video_source_message(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_seek_mode(codec, buffer, offset, error);
     case 131:
-      return av_player_message_codec_read_av_player_media_metadata_message(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_video_source_message(codec, buffer, offset, error);
     case 132:
-      return av_player_message_codec_read_av_player_enter_pip_request(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_media_metadata_message(codec, buffer, offset, error);
     case 133:
-      return av_player_message_codec_read_av_player_media_metadata_request(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_enter_pip_request(codec, buffer, offset, error);
     case 134:
-      return av_player_message_codec_read_av_player_abr_config_message(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_media_metadata_request(codec, buffer, offset, error);
     case 135:
-      return av_player_message_codec_read_av_player_set_abr_config_request(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_abr_config_message(codec, buffer, offset, error);
     case 136:
-      return av_player_message_codec_read_av_player_decoder_info_message(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_set_abr_config_request(codec, buffer, offset, error);
     case 137:
-      return av_player_message_codec_read_av_player_subtitle_track_message(codec, buffer, offset, error);
+      return av_player_message_codec_read_av_player_decoder_info_message(codec, buffer, offset, error);
     case 138:
+      return av_player_message_codec_read_av_player_subtitle_track_message(codec, buffer, offset, error);
+    case 139:
       return av_player_message_codec_read_av_player_select_subtitle_track_request(codec, buffer, offset, error);
+    case 140:
+      return av_player_message_codec_read_av_player_render_stats_message(codec, buffer, offset, error);
+    case 141:
+      return av_player_message_codec_read_av_player_create_result_message(codec, buffer, offset, error);
+    case 142:
+      return av_player_message_codec_read_av_player_clock_anchor_message(codec, buffer, offset, error);
+    case 143:
+      return av_player_message_codec_read_av_player_state_update_message(codec, buffer, offset, error);
     default:
       return FL_STANDARD_MESSAGE_CODEC_CLASS(av_player_message_codec_parent_class)->read_value_of_type(codec, buffer, offset, type, error);
   }
@@ -1079,10 +1555,10 @@ static void av_player_av_player_host_api_create_response_class_init(AvPlayerAvPl
   G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_create_response_dispose;
 }
 
-static AvPlayerAvPlayerHostApiCreateResponse* av_player_av_player_host_api_create_response_new(int64_t return_value) {
+static AvPlayerAvPlayerHostApiCreateResponse* av_player_av_player_host_api_create_response_new(AvPlayerCreateResultMessage* return_value) {
   AvPlayerAvPlayerHostApiCreateResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_CREATE_RESPONSE(g_object_new(av_player_av_player_host_api_create_response_get_type(), nullptr));
   self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_int(return_value));
+  fl_value_append_take(self->value, fl_value_new_custom_object(141, G_OBJECT(return_value)));
   return self;
 }
 
@@ -1823,7 +2299,7 @@ static void av_player_av_player_host_api_get_decoder_info_response_class_init(Av
 static AvPlayerAvPlayerHostApiGetDecoderInfoResponse* av_player_av_player_host_api_get_decoder_info_response_new(AvPlayerDecoderInfoMessage* return_value) {
   AvPlayerAvPlayerHostApiGetDecoderInfoResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_GET_DECODER_INFO_RESPONSE(g_object_new(av_player_av_player_host_api_get_decoder_info_response_get_type(), nullptr));
   self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_custom_object(136, G_OBJECT(return_value)));
+  fl_value_append_take(self->value, fl_value_new_custom_object(137, G_OBJECT(return_value)));
   return self;
 }
 
@@ -1877,36 +2353,348 @@ static AvPlayerAvPlayerHostApiGetSubtitleTracksResponse* av_player_av_player_hos
 
 G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse, av_player_av_player_host_api_select_subtitle_track_response, AV_PLAYER, AV_PLAYER_HOST_API_SELECT_SUBTITLE_TRACK_RESPONSE, GObject)
 
-struct _AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse {
+struct _AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse, av_player_av_player_host_api_select_subtitle_track_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_select_subtitle_track_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SELECT_SUBTITLE_TRACK_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_select_subtitle_track_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_select_subtitle_track_response_init(AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self) {
+}
+
+static void av_player_av_player_host_api_select_subtitle_track_response_class_init(AvPlayerAvPlayerHostApiSelectSubtitleTrackResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_select_subtitle_track_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* av_player_av_player_host_api_select_subtitle_track_response_new() {
+  AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SELECT_SUBTITLE_TRACK_RESPONSE(g_object_new(av_player_av_player_host_api_select_subtitle_track_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* av_player_av_player_host_api_select_subtitle_track_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SELECT_SUBTITLE_TRACK_RESPONSE(g_object_new(av_player_av_player_host_api_select_subtitle_track_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiSetRenderSizeResponse, av_player_av_player_host_api_set_render_size_response, AV_PLAYER, AV_PLAYER_HOST_API_SET_RENDER_SIZE_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiSetRenderSizeResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiSetRenderSizeResponse, av_player_av_player_host_api_set_render_size_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_set_render_size_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiSetRenderSizeResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_RENDER_SIZE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_set_render_size_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_set_render_size_response_init(AvPlayerAvPlayerHostApiSetRenderSizeResponse* self) {
+}
+
+static void av_player_av_player_host_api_set_render_size_response_class_init(AvPlayerAvPlayerHostApiSetRenderSizeResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_set_render_size_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiSetRenderSizeResponse* av_player_av_player_host_api_set_render_size_response_new() {
+  AvPlayerAvPlayerHostApiSetRenderSizeResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_RENDER_SIZE_RESPONSE(g_object_new(av_player_av_player_host_api_set_render_size_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiSetRenderSizeResponse* av_player_av_player_host_api_set_render_size_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiSetRenderSizeResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_RENDER_SIZE_RESPONSE(g_object_new(av_player_av_player_host_api_set_render_size_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiSetNativeColorConversionResponse, av_player_av_player_host_api_set_native_color_conversion_response, AV_PLAYER, AV_PLAYER_HOST_API_SET_NATIVE_COLOR_CONVERSION_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiSetNativeColorConversionResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiSetNativeColorConversionResponse, av_player_av_player_host_api_set_native_color_conversion_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_set_native_color_conversion_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiSetNativeColorConversionResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_NATIVE_COLOR_CONVERSION_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_set_native_color_conversion_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_set_native_color_conversion_response_init(AvPlayerAvPlayerHostApiSetNativeColorConversionResponse* self) {
+}
+
+static void av_player_av_player_host_api_set_native_color_conversion_response_class_init(AvPlayerAvPlayerHostApiSetNativeColorConversionResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_set_native_color_conversion_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiSetNativeColorConversionResponse* av_player_av_player_host_api_set_native_color_conversion_response_new() {
+  AvPlayerAvPlayerHostApiSetNativeColorConversionResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_NATIVE_COLOR_CONVERSION_RESPONSE(g_object_new(av_player_av_player_host_api_set_native_color_conversion_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiSetNativeColorConversionResponse* av_player_av_player_host_api_set_native_color_conversion_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiSetNativeColorConversionResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_NATIVE_COLOR_CONVERSION_RESPONSE(g_object_new(av_player_av_player_host_api_set_native_color_conversion_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiSetConversionThreadsResponse, av_player_av_player_host_api_set_conversion_threads_response, AV_PLAYER, AV_PLAYER_HOST_API_SET_CONVERSION_THREADS_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiSetConversionThreadsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiSetConversionThreadsResponse, av_player_av_player_host_api_set_conversion_threads_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_set_conversion_threads_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiSetConversionThreadsResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_CONVERSION_THREADS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_set_conversion_threads_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_set_conversion_threads_response_init(AvPlayerAvPlayerHostApiSetConversionThreadsResponse* self) {
+}
+
+static void av_player_av_player_host_api_set_conversion_threads_response_class_init(AvPlayerAvPlayerHostApiSetConversionThreadsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_set_conversion_threads_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiSetConversionThreadsResponse* av_player_av_player_host_api_set_conversion_threads_response_new() {
+  AvPlayerAvPlayerHostApiSetConversionThreadsResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_CONVERSION_THREADS_RESPONSE(g_object_new(av_player_av_player_host_api_set_conversion_threads_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiSetConversionThreadsResponse* av_player_av_player_host_api_set_conversion_threads_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiSetConversionThreadsResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_CONVERSION_THREADS_RESPONSE(g_object_new(av_player_av_player_host_api_set_conversion_threads_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiGetRenderStatsResponse, av_player_av_player_host_api_get_render_stats_response, AV_PLAYER, AV_PLAYER_HOST_API_GET_RENDER_STATS_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiGetRenderStatsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiGetRenderStatsResponse, av_player_av_player_host_api_get_render_stats_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_get_render_stats_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiGetRenderStatsResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_GET_RENDER_STATS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_get_render_stats_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_get_render_stats_response_init(AvPlayerAvPlayerHostApiGetRenderStatsResponse* self) {
+}
+
+static void av_player_av_player_host_api_get_render_stats_response_class_init(AvPlayerAvPlayerHostApiGetRenderStatsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_get_render_stats_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiGetRenderStatsResponse* av_player_av_player_host_api_get_render_stats_response_new(AvPlayerRenderStatsMessage* return_value) {
+  AvPlayerAvPlayerHostApiGetRenderStatsResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_GET_RENDER_STATS_RESPONSE(g_object_new(av_player_av_player_host_api_get_render_stats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(140, G_OBJECT(return_value)));
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiGetRenderStatsResponse* av_player_av_player_host_api_get_render_stats_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiGetRenderStatsResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_GET_RENDER_STATS_RESPONSE(g_object_new(av_player_av_player_host_api_get_render_stats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiGetKeyframesResponse, av_player_av_player_host_api_get_keyframes_response, AV_PLAYER, AV_PLAYER_HOST_API_GET_KEYFRAMES_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiGetKeyframesResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiGetKeyframesResponse, av_player_av_player_host_api_get_keyframes_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_get_keyframes_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiGetKeyframesResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_GET_KEYFRAMES_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_get_keyframes_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_get_keyframes_response_init(AvPlayerAvPlayerHostApiGetKeyframesResponse* self) {
+}
+
+static void av_player_av_player_host_api_get_keyframes_response_class_init(AvPlayerAvPlayerHostApiGetKeyframesResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_get_keyframes_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiGetKeyframesResponse* av_player_av_player_host_api_get_keyframes_response_new(FlValue* return_value) {
+  AvPlayerAvPlayerHostApiGetKeyframesResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_GET_KEYFRAMES_RESPONSE(g_object_new(av_player_av_player_host_api_get_keyframes_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiGetKeyframesResponse* av_player_av_player_host_api_get_keyframes_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiGetKeyframesResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_GET_KEYFRAMES_RESPONSE(g_object_new(av_player_av_player_host_api_get_keyframes_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiQueueNextResponse, av_player_av_player_host_api_queue_next_response, AV_PLAYER, AV_PLAYER_HOST_API_QUEUE_NEXT_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiQueueNextResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiQueueNextResponse, av_player_av_player_host_api_queue_next_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_queue_next_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiQueueNextResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_QUEUE_NEXT_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_queue_next_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_queue_next_response_init(AvPlayerAvPlayerHostApiQueueNextResponse* self) {
+}
+
+static void av_player_av_player_host_api_queue_next_response_class_init(AvPlayerAvPlayerHostApiQueueNextResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_queue_next_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiQueueNextResponse* av_player_av_player_host_api_queue_next_response_new(gboolean return_value) {
+  AvPlayerAvPlayerHostApiQueueNextResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_QUEUE_NEXT_RESPONSE(g_object_new(av_player_av_player_host_api_queue_next_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_bool(return_value));
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiQueueNextResponse* av_player_av_player_host_api_queue_next_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiQueueNextResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_QUEUE_NEXT_RESPONSE(g_object_new(av_player_av_player_host_api_queue_next_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiPreloadResponse, av_player_av_player_host_api_preload_response, AV_PLAYER, AV_PLAYER_HOST_API_PRELOAD_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiPreloadResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiPreloadResponse, av_player_av_player_host_api_preload_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_host_api_preload_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiPreloadResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_PRELOAD_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_host_api_preload_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_host_api_preload_response_init(AvPlayerAvPlayerHostApiPreloadResponse* self) {
+}
+
+static void av_player_av_player_host_api_preload_response_class_init(AvPlayerAvPlayerHostApiPreloadResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_preload_response_dispose;
+}
+
+static AvPlayerAvPlayerHostApiPreloadResponse* av_player_av_player_host_api_preload_response_new() {
+  AvPlayerAvPlayerHostApiPreloadResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_PRELOAD_RESPONSE(g_object_new(av_player_av_player_host_api_preload_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static AvPlayerAvPlayerHostApiPreloadResponse* av_player_av_player_host_api_preload_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiPreloadResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_PRELOAD_RESPONSE(g_object_new(av_player_av_player_host_api_preload_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApiSetSourceResponse, av_player_av_player_host_api_set_source_response, AV_PLAYER, AV_PLAYER_HOST_API_SET_SOURCE_RESPONSE, GObject)
+
+struct _AvPlayerAvPlayerHostApiSetSourceResponse {
   GObject parent_instance;
 
   FlValue* value;
 };
 
-G_DEFINE_TYPE(AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse, av_player_av_player_host_api_select_subtitle_track_response, G_TYPE_OBJECT)
+G_DEFINE_TYPE(AvPlayerAvPlayerHostApiSetSourceResponse, av_player_av_player_host_api_set_source_response, G_TYPE_OBJECT)
 
-static void av_player_av_player_host_api_select_subtitle_track_response_dispose(GObject* object) {
-  AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SELECT_SUBTITLE_TRACK_RESPONSE(object);
+static void av_player_av_player_host_api_set_source_response_dispose(GObject* object) {
+  AvPlayerAvPlayerHostApiSetSourceResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_SOURCE_RESPONSE(object);
   g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(av_player_av_player_host_api_select_subtitle_track_response_parent_class)->dispose(object);
+  G_OBJECT_CLASS(av_player_av_player_host_api_set_source_response_parent_class)->dispose(object);
 }
 
-static void av_player_av_player_host_api_select_subtitle_track_response_init(AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self) {
+static void av_player_av_player_host_api_set_source_response_init(AvPlayerAvPlayerHostApiSetSourceResponse* self) {
 }
 
-static void av_player_av_player_host_api_select_subtitle_track_response_class_init(AvPlayerAvPlayerHostApiSelectSubtitleTrackResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_select_subtitle_track_response_dispose;
+static void av_player_av_player_host_api_set_source_response_class_init(AvPlayerAvPlayerHostApiSetSourceResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_host_api_set_source_response_dispose;
 }
 
-static AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* av_player_av_player_host_api_select_subtitle_track_response_new() {
-  AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SELECT_SUBTITLE_TRACK_RESPONSE(g_object_new(av_player_av_player_host_api_select_subtitle_track_response_get_type(), nullptr));
+static AvPlayerAvPlayerHostApiSetSourceResponse* av_player_av_player_host_api_set_source_response_new(gboolean return_value) {
+  AvPlayerAvPlayerHostApiSetSourceResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_SOURCE_RESPONSE(g_object_new(av_player_av_player_host_api_set_source_response_get_type(), nullptr));
   self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_null());
+  fl_value_append_take(self->value, fl_value_new_bool(return_value));
   return self;
 }
 
-static AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* av_player_av_player_host_api_select_subtitle_track_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  AvPlayerAvPlayerHostApiSelectSubtitleTrackResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SELECT_SUBTITLE_TRACK_RESPONSE(g_object_new(av_player_av_player_host_api_select_subtitle_track_response_get_type(), nullptr));
+static AvPlayerAvPlayerHostApiSetSourceResponse* av_player_av_player_host_api_set_source_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  AvPlayerAvPlayerHostApiSetSourceResponse* self = AV_PLAYER_AV_PLAYER_HOST_API_SET_SOURCE_RESPONSE(g_object_new(av_player_av_player_host_api_set_source_response_get_type(), nullptr));
   self->value = fl_value_new_list();
   fl_value_append_take(self->value, fl_value_new_string(code));
   fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
@@ -2011,8 +2799,10 @@ static void av_player_av_player_host_api_seek_to_cb(FlBasicMessageChannel* chann
   int64_t player_id = fl_value_get_int(value0);
   FlValue* value1 = fl_value_get_list_value(message_, 1);
   int64_t position_ms = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  AvPlayerSeekMode mode = static_cast<AvPlayerSeekMode>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value2)))));
   g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
-  self->vtable->seek_to(player_id, position_ms, handle, self->user_data);
+  self->vtable->seek_to(player_id, position_ms, mode, handle, self->user_data);
 }
 
 static void av_player_av_player_host_api_set_playback_speed_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
@@ -2238,6 +3028,122 @@ static void av_player_av_player_host_api_select_subtitle_track_cb(FlBasicMessage
   self->vtable->select_subtitle_track(request, handle, self->user_data);
 }
 
+static void av_player_av_player_host_api_set_render_size_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_render_size == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t width = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  int64_t height = fl_value_get_int(value2);
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->set_render_size(player_id, width, height, handle, self->user_data);
+}
+
+static void av_player_av_player_host_api_set_native_color_conversion_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_native_color_conversion == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  gboolean enabled = fl_value_get_bool(value1);
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->set_native_color_conversion(player_id, enabled, handle, self->user_data);
+}
+
+static void av_player_av_player_host_api_set_conversion_threads_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_conversion_threads == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t threads = fl_value_get_int(value1);
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->set_conversion_threads(player_id, threads, handle, self->user_data);
+}
+
+static void av_player_av_player_host_api_get_render_stats_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->get_render_stats == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->get_render_stats(player_id, handle, self->user_data);
+}
+
+static void av_player_av_player_host_api_get_keyframes_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->get_keyframes == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->get_keyframes(player_id, handle, self->user_data);
+}
+
+static void av_player_av_player_host_api_queue_next_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->queue_next == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  AvPlayerVideoSourceMessage* source = AV_PLAYER_VIDEO_SOURCE_MESSAGE(fl_value_get_custom_value_object(value1));
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->queue_next(player_id, source, handle, self->user_data);
+}
+
+static void av_player_av_player_host_api_preload_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->preload == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  AvPlayerVideoSourceMessage* source = AV_PLAYER_VIDEO_SOURCE_MESSAGE(fl_value_get_custom_value_object(value0));
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->preload(source, handle, self->user_data);
+}
+
+static void av_player_av_player_host_api_set_source_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  AvPlayerAvPlayerHostApi* self = AV_PLAYER_AV_PLAYER_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_source == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t player_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  AvPlayerVideoSourceMessage* source = AV_PLAYER_VIDEO_SOURCE_MESSAGE(fl_value_get_custom_value_object(value1));
+  g_autoptr(AvPlayerAvPlayerHostApiResponseHandle) handle = av_player_av_player_host_api_response_handle_new(channel, response_handle);
+  self->vtable->set_source(player_id, source, handle, self->user_data);
+}
+
 void av_player_av_player_host_api_set_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix, const AvPlayerAvPlayerHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
   g_autofree gchar* dot_suffix = suffix != nullptr ? g_strdup_printf(".%s", suffix) : g_strdup("");
   g_autoptr(AvPlayerAvPlayerHostApi) api_data = av_player_av_player_host_api_new(vtable, user_data, user_data_free_func);
@@ -2309,6 +3215,30 @@ void av_player_av_player_host_api_set_method_handlers(FlBinaryMessenger* messeng
   g_autofree gchar* select_subtitle_track_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.selectSubtitleTrack%s", dot_suffix);
   g_autoptr(FlBasicMessageChannel) select_subtitle_track_channel = fl_basic_message_channel_new(messenger, select_subtitle_track_channel_name, FL_MESSAGE_CODEC(codec));
   fl_basic_message_channel_set_message_handler(select_subtitle_track_channel, av_player_av_player_host_api_select_subtitle_track_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_render_size_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setRenderSize%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_render_size_channel = fl_basic_message_channel_new(messenger, set_render_size_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_render_size_channel, av_player_av_player_host_api_set_render_size_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_native_color_conversion_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setNativeColorConversion%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_native_color_conversion_channel = fl_basic_message_channel_new(messenger, set_native_color_conversion_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_native_color_conversion_channel, av_player_av_player_host_api_set_native_color_conversion_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_conversion_threads_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setConversionThreads%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_conversion_threads_channel = fl_basic_message_channel_new(messenger, set_conversion_threads_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_conversion_threads_channel, av_player_av_player_host_api_set_conversion_threads_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* get_render_stats_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.getRenderStats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_render_stats_channel = fl_basic_message_channel_new(messenger, get_render_stats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_render_stats_channel, av_player_av_player_host_api_get_render_stats_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* get_keyframes_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.getKeyframes%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_keyframes_channel = fl_basic_message_channel_new(messenger, get_keyframes_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_keyframes_channel, av_player_av_player_host_api_get_keyframes_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* queue_next_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.queueNext%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) queue_next_channel = fl_basic_message_channel_new(messenger, queue_next_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(queue_next_channel, av_player_av_player_host_api_queue_next_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* preload_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.preload%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) preload_channel = fl_basic_message_channel_new(messenger, preload_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(preload_channel, av_player_av_player_host_api_preload_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_source_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setSource%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_source_channel = fl_basic_message_channel_new(messenger, set_source_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_source_channel, av_player_av_player_host_api_set_source_cb, g_object_ref(api_data), g_object_unref);
 }
 
 void av_player_av_player_host_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix) {
@@ -2381,9 +3311,33 @@ void av_player_av_player_host_api_clear_method_handlers(FlBinaryMessenger* messe
   g_autofree gchar* select_subtitle_track_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.selectSubtitleTrack%s", dot_suffix);
   g_autoptr(FlBasicMessageChannel) select_subtitle_track_channel = fl_basic_message_channel_new(messenger, select_subtitle_track_channel_name, FL_MESSAGE_CODEC(codec));
   fl_basic_message_channel_set_message_handler(select_subtitle_track_channel, nullptr, nullptr, nullptr);
-}
-
-void av_player_av_player_host_api_respond_create(AvPlayerAvPlayerHostApiResponseHandle* response_handle, int64_t return_value) {
+  g_autofree gchar* set_render_size_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setRenderSize%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_render_size_channel = fl_basic_message_channel_new(messenger, set_render_size_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_render_size_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_native_color_conversion_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setNativeColorConversion%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_native_color_conversion_channel = fl_basic_message_channel_new(messenger, set_native_color_conversion_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_native_color_conversion_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_conversion_threads_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setConversionThreads%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_conversion_threads_channel = fl_basic_message_channel_new(messenger, set_conversion_threads_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_conversion_threads_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* get_render_stats_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.getRenderStats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_render_stats_channel = fl_basic_message_channel_new(messenger, get_render_stats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_render_stats_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* get_keyframes_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.getKeyframes%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_keyframes_channel = fl_basic_message_channel_new(messenger, get_keyframes_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_keyframes_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* queue_next_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.queueNext%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) queue_next_channel = fl_basic_message_channel_new(messenger, queue_next_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(queue_next_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* preload_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.preload%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) preload_channel = fl_basic_message_channel_new(messenger, preload_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(preload_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_source_channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerHostApi.setSource%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_source_channel = fl_basic_message_channel_new(messenger, set_source_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_source_channel, nullptr, nullptr, nullptr);
+}
+
+void av_player_av_player_host_api_respond_create(AvPlayerAvPlayerHostApiResponseHandle* response_handle, AvPlayerCreateResultMessage* return_value) {
   g_autoptr(AvPlayerAvPlayerHostApiCreateResponse) response = av_player_av_player_host_api_create_response_new(return_value);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
@@ -2734,3 +3688,319 @@ void av_player_av_player_host_api_respond_error_select_subtitle_track(AvPlayerAv
     g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "selectSubtitleTrack", error->message);
   }
 }
+
+void av_player_av_player_host_api_respond_set_render_size(AvPlayerAvPlayerHostApiResponseHandle* response_handle) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetRenderSizeResponse) response = av_player_av_player_host_api_set_render_size_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setRenderSize", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_set_render_size(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetRenderSizeResponse) response = av_player_av_player_host_api_set_render_size_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setRenderSize", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_set_native_color_conversion(AvPlayerAvPlayerHostApiResponseHandle* response_handle) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetNativeColorConversionResponse) response = av_player_av_player_host_api_set_native_color_conversion_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setNativeColorConversion", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_set_native_color_conversion(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetNativeColorConversionResponse) response = av_player_av_player_host_api_set_native_color_conversion_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setNativeColorConversion", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_set_conversion_threads(AvPlayerAvPlayerHostApiResponseHandle* response_handle) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetConversionThreadsResponse) response = av_player_av_player_host_api_set_conversion_threads_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setConversionThreads", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_set_conversion_threads(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetConversionThreadsResponse) response = av_player_av_player_host_api_set_conversion_threads_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setConversionThreads", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_get_render_stats(AvPlayerAvPlayerHostApiResponseHandle* response_handle, AvPlayerRenderStatsMessage* return_value) {
+  g_autoptr(AvPlayerAvPlayerHostApiGetRenderStatsResponse) response = av_player_av_player_host_api_get_render_stats_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "getRenderStats", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_get_render_stats(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiGetRenderStatsResponse) response = av_player_av_player_host_api_get_render_stats_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "getRenderStats", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_get_keyframes(AvPlayerAvPlayerHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(AvPlayerAvPlayerHostApiGetKeyframesResponse) response = av_player_av_player_host_api_get_keyframes_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "getKeyframes", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_get_keyframes(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiGetKeyframesResponse) response = av_player_av_player_host_api_get_keyframes_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "getKeyframes", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_queue_next(AvPlayerAvPlayerHostApiResponseHandle* response_handle, gboolean return_value) {
+  g_autoptr(AvPlayerAvPlayerHostApiQueueNextResponse) response = av_player_av_player_host_api_queue_next_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "queueNext", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_queue_next(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiQueueNextResponse) response = av_player_av_player_host_api_queue_next_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "queueNext", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_preload(AvPlayerAvPlayerHostApiResponseHandle* response_handle) {
+  g_autoptr(AvPlayerAvPlayerHostApiPreloadResponse) response = av_player_av_player_host_api_preload_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "preload", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_preload(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiPreloadResponse) response = av_player_av_player_host_api_preload_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "preload", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_set_source(AvPlayerAvPlayerHostApiResponseHandle* response_handle, gboolean return_value) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetSourceResponse) response = av_player_av_player_host_api_set_source_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setSource", error->message);
+  }
+}
+
+void av_player_av_player_host_api_respond_error_set_source(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(AvPlayerAvPlayerHostApiSetSourceResponse) response = av_player_av_player_host_api_set_source_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "AvPlayerHostApi", "setSource", error->message);
+  }
+}
+
+struct _AvPlayerAvPlayerEventApi {
+  GObject parent_instance;
+
+  FlBinaryMessenger* messenger;
+  gchar *suffix;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerEventApi, av_player_av_player_event_api, G_TYPE_OBJECT)
+
+static void av_player_av_player_event_api_dispose(GObject* object) {
+  AvPlayerAvPlayerEventApi* self = AV_PLAYER_AV_PLAYER_EVENT_API(object);
+  g_clear_object(&self->messenger);
+  g_clear_pointer(&self->suffix, g_free);
+  G_OBJECT_CLASS(av_player_av_player_event_api_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_event_api_init(AvPlayerAvPlayerEventApi* self) {
+}
+
+static void av_player_av_player_event_api_class_init(AvPlayerAvPlayerEventApiClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_event_api_dispose;
+}
+
+AvPlayerAvPlayerEventApi* av_player_av_player_event_api_new(FlBinaryMessenger* messenger, const gchar* suffix) {
+  AvPlayerAvPlayerEventApi* self = AV_PLAYER_AV_PLAYER_EVENT_API(g_object_new(av_player_av_player_event_api_get_type(), nullptr));
+  self->messenger = FL_BINARY_MESSENGER(g_object_ref(messenger));
+  self->suffix = suffix != nullptr ? g_strdup_printf(".%s", suffix) : g_strdup("");
+  return self;
+}
+
+struct _AvPlayerAvPlayerEventApiOnClockAnchorResponse {
+  GObject parent_instance;
+
+  FlValue* error;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerEventApiOnClockAnchorResponse, av_player_av_player_event_api_on_clock_anchor_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_event_api_on_clock_anchor_response_dispose(GObject* object) {
+  AvPlayerAvPlayerEventApiOnClockAnchorResponse* self = AV_PLAYER_AV_PLAYER_EVENT_API_ON_CLOCK_ANCHOR_RESPONSE(object);
+  g_clear_pointer(&self->error, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_event_api_on_clock_anchor_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_event_api_on_clock_anchor_response_init(AvPlayerAvPlayerEventApiOnClockAnchorResponse* self) {
+}
+
+static void av_player_av_player_event_api_on_clock_anchor_response_class_init(AvPlayerAvPlayerEventApiOnClockAnchorResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_event_api_on_clock_anchor_response_dispose;
+}
+
+static AvPlayerAvPlayerEventApiOnClockAnchorResponse* av_player_av_player_event_api_on_clock_anchor_response_new(FlValue* response) {
+  AvPlayerAvPlayerEventApiOnClockAnchorResponse* self = AV_PLAYER_AV_PLAYER_EVENT_API_ON_CLOCK_ANCHOR_RESPONSE(g_object_new(av_player_av_player_event_api_on_clock_anchor_response_get_type(), nullptr));
+  if (fl_value_get_length(response) > 1) {
+    self->error = fl_value_ref(response);
+  }
+  return self;
+}
+
+gboolean av_player_av_player_event_api_on_clock_anchor_response_is_error(AvPlayerAvPlayerEventApiOnClockAnchorResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_CLOCK_ANCHOR_RESPONSE(self), FALSE);
+  return self->error != nullptr;
+}
+
+const gchar* av_player_av_player_event_api_on_clock_anchor_response_get_error_code(AvPlayerAvPlayerEventApiOnClockAnchorResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_CLOCK_ANCHOR_RESPONSE(self), nullptr);
+  g_assert(av_player_av_player_event_api_on_clock_anchor_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 0));
+}
+
+const gchar* av_player_av_player_event_api_on_clock_anchor_response_get_error_message(AvPlayerAvPlayerEventApiOnClockAnchorResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_CLOCK_ANCHOR_RESPONSE(self), nullptr);
+  g_assert(av_player_av_player_event_api_on_clock_anchor_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 1));
+}
+
+FlValue* av_player_av_player_event_api_on_clock_anchor_response_get_error_details(AvPlayerAvPlayerEventApiOnClockAnchorResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_CLOCK_ANCHOR_RESPONSE(self), nullptr);
+  g_assert(av_player_av_player_event_api_on_clock_anchor_response_is_error(self));
+  return fl_value_get_list_value(self->error, 2);
+}
+
+static void av_player_av_player_event_api_on_clock_anchor_cb(GObject* object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(user_data);
+  g_task_return_pointer(task, result, g_object_unref);
+}
+
+void av_player_av_player_event_api_on_clock_anchor(AvPlayerAvPlayerEventApi* self, AvPlayerClockAnchorMessage* anchor, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
+  g_autoptr(FlValue) args = fl_value_new_list();
+  fl_value_append_take(args, fl_value_new_custom_object(142, G_OBJECT(anchor)));
+  g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerEventApi.onClockAnchor%s", self->suffix);
+  g_autoptr(AvPlayerMessageCodec) codec = av_player_message_codec_new();
+  FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
+  GTask* task = g_task_new(self, cancellable, callback, user_data);
+  g_task_set_task_data(task, channel, g_object_unref);
+  fl_basic_message_channel_send(channel, args, cancellable, av_player_av_player_event_api_on_clock_anchor_cb, task);
+}
+
+AvPlayerAvPlayerEventApiOnClockAnchorResponse* av_player_av_player_event_api_on_clock_anchor_finish(AvPlayerAvPlayerEventApi* self, GAsyncResult* result, GError** error) {
+  g_autoptr(GTask) task = G_TASK(result);
+  GAsyncResult* r = G_ASYNC_RESULT(g_task_propagate_pointer(task, nullptr));
+  FlBasicMessageChannel* channel = FL_BASIC_MESSAGE_CHANNEL(g_task_get_task_data(task));
+  g_autoptr(FlValue) response = fl_basic_message_channel_send_finish(channel, r, error);
+  if (response == nullptr) { 
+    return nullptr;
+  }
+  return av_player_av_player_event_api_on_clock_anchor_response_new(response);
+}
+
+struct _AvPlayerAvPlayerEventApiOnStateUpdateResponse {
+  GObject parent_instance;
+
+  FlValue* error;
+};
+
+G_DEFINE_TYPE(AvPlayerAvPlayerEventApiOnStateUpdateResponse, av_player_av_player_event_api_on_state_update_response, G_TYPE_OBJECT)
+
+static void av_player_av_player_event_api_on_state_update_response_dispose(GObject* object) {
+  AvPlayerAvPlayerEventApiOnStateUpdateResponse* self = AV_PLAYER_AV_PLAYER_EVENT_API_ON_STATE_UPDATE_RESPONSE(object);
+  g_clear_pointer(&self->error, fl_value_unref);
+  G_OBJECT_CLASS(av_player_av_player_event_api_on_state_update_response_parent_class)->dispose(object);
+}
+
+static void av_player_av_player_event_api_on_state_update_response_init(AvPlayerAvPlayerEventApiOnStateUpdateResponse* self) {
+}
+
+static void av_player_av_player_event_api_on_state_update_response_class_init(AvPlayerAvPlayerEventApiOnStateUpdateResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = av_player_av_player_event_api_on_state_update_response_dispose;
+}
+
+static AvPlayerAvPlayerEventApiOnStateUpdateResponse* av_player_av_player_event_api_on_state_update_response_new(FlValue* response) {
+  AvPlayerAvPlayerEventApiOnStateUpdateResponse* self = AV_PLAYER_AV_PLAYER_EVENT_API_ON_STATE_UPDATE_RESPONSE(g_object_new(av_player_av_player_event_api_on_state_update_response_get_type(), nullptr));
+  if (fl_value_get_length(response) > 1) {
+    self->error = fl_value_ref(response);
+  }
+  return self;
+}
+
+gboolean av_player_av_player_event_api_on_state_update_response_is_error(AvPlayerAvPlayerEventApiOnStateUpdateResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_STATE_UPDATE_RESPONSE(self), FALSE);
+  return self->error != nullptr;
+}
+
+const gchar* av_player_av_player_event_api_on_state_update_response_get_error_code(AvPlayerAvPlayerEventApiOnStateUpdateResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_STATE_UPDATE_RESPONSE(self), nullptr);
+  g_assert(av_player_av_player_event_api_on_state_update_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 0));
+}
+
+const gchar* av_player_av_player_event_api_on_state_update_response_get_error_message(AvPlayerAvPlayerEventApiOnStateUpdateResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_STATE_UPDATE_RESPONSE(self), nullptr);
+  g_assert(av_player_av_player_event_api_on_state_update_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 1));
+}
+
+FlValue* av_player_av_player_event_api_on_state_update_response_get_error_details(AvPlayerAvPlayerEventApiOnStateUpdateResponse* self) {
+  g_return_val_if_fail(AV_PLAYER_IS_AV_PLAYER_EVENT_API_ON_STATE_UPDATE_RESPONSE(self), nullptr);
+  g_assert(av_player_av_player_event_api_on_state_update_response_is_error(self));
+  return fl_value_get_list_value(self->error, 2);
+}
+
+static void av_player_av_player_event_api_on_state_update_cb(GObject* object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(user_data);
+  g_task_return_pointer(task, result, g_object_unref);
+}
+
+void av_player_av_player_event_api_on_state_update(AvPlayerAvPlayerEventApi* self, AvPlayerStateUpdateMessage* update, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
+  g_autoptr(FlValue) args = fl_value_new_list();
+  fl_value_append_take(args, fl_value_new_custom_object(143, G_OBJECT(update)));
+  g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.av_player.AvPlayerEventApi.onStateUpdate%s", self->suffix);
+  g_autoptr(AvPlayerMessageCodec) codec = av_player_message_codec_new();
+  FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
+  GTask* task = g_task_new(self, cancellable, callback, user_data);
+  g_task_set_task_data(task, channel, g_object_unref);
+  fl_basic_message_channel_send(channel, args, cancellable, av_player_av_player_event_api_on_state_update_cb, task);
+}
+
+AvPlayerAvPlayerEventApiOnStateUpdateResponse* av_player_av_player_event_api_on_state_update_finish(AvPlayerAvPlayerEventApi* self, GAsyncResult* result, GError** error) {
+  g_autoptr(GTask) task = G_TASK(result);
+  GAsyncResult* r = G_ASYNC_RESULT(g_task_propagate_pointer(task, nullptr));
+  FlBasicMessageChannel* channel = FL_BASIC_MESSAGE_CHANNEL(g_task_get_task_data(task));
+  g_autoptr(FlValue) response = fl_basic_message_channel_send_finish(channel, r, error);
+  if (response == nullptr) { 
+    return nullptr;
+  }
+  return av_player_av_player_event_api_on_state_update_response_new(response);
+}
@@ -21,6 +21,21 @@ typedef enum {
   AV_PLAYER_SOURCE_TYPE_FILE = 2
 } AvPlayerSourceType;
 
+/**
+ * AvPlayerSeekMode:
+ * AV_PLAYER_SEEK_MODE_ACCURATE:
+ * AV_PLAYER_SEEK_MODE_KEYFRAME_BEFORE:
+ * AV_PLAYER_SEEK_MODE_KEYFRAME_AFTER:
+ * AV_PLAYER_SEEK_MODE_NEAREST_KEYFRAME:
+ *
+ */
+typedef enum {
+  AV_PLAYER_SEEK_MODE_ACCURATE = 0,
+  AV_PLAYER_SEEK_MODE_KEYFRAME_BEFORE = 1,
+  AV_PLAYER_SEEK_MODE_KEYFRAME_AFTER = 2,
+  AV_PLAYER_SEEK_MODE_NEAREST_KEYFRAME = 3
+} AvPlayerSeekMode;
+
 /**
  * AvPlayerVideoSourceMessage:
  *
@@ -462,6 +477,323 @@ int64_t av_player_select_subtitle_track_request_get_player_id(AvPlayerSelectSubt
  */
 const gchar* av_player_select_subtitle_track_request_get_track_id(AvPlayerSelectSubtitleTrackRequest* object);
 
+/**
+ * AvPlayerRenderStatsMessage:
+ *
+ */
+
+G_DECLARE_FINAL_TYPE(AvPlayerRenderStatsMessage, av_player_render_stats_message, AV_PLAYER, RENDER_STATS_MESSAGE, GObject)
+
+/**
+ * av_player_render_stats_message_new:
+ * frames_decoded: field in this object.
+ * frames_presented: field in this object.
+ * frames_dropped: field in this object.
+ * conversion_p50_us: field in this object.
+ * conversion_p95_us: field in this object.
+ * conversion_p99_us: field in this object.
+ * copy_p50_us: field in this object.
+ * copy_p95_us: field in this object.
+ * copy_p99_us: field in this object.
+ * lateness_p50_us: field in this object.
+ * lateness_p95_us: field in this object.
+ * lateness_p99_us: field in this object.
+ * audio_filter_p50_us: field in this object.
+ * audio_filter_p95_us: field in this object.
+ * audio_filter_p99_us: field in this object.
+ *
+ * Creates a new #RenderStatsMessage object.
+ *
+ * Returns: a new #AvPlayerRenderStatsMessage
+ */
+AvPlayerRenderStatsMessage* av_player_render_stats_message_new(int64_t frames_decoded, int64_t frames_presented, int64_t frames_dropped, int64_t conversion_p50_us, int64_t conversion_p95_us, int64_t conversion_p99_us, int64_t copy_p50_us, int64_t copy_p95_us, int64_t copy_p99_us, int64_t lateness_p50_us, int64_t lateness_p95_us, int64_t lateness_p99_us, int64_t audio_filter_p50_us, int64_t audio_filter_p95_us, int64_t audio_filter_p99_us);
+
+/**
+ * av_player_render_stats_message_get_frames_decoded
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the framesDecoded field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_frames_decoded(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_frames_presented
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the framesPresented field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_frames_presented(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_frames_dropped
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the framesDropped field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_frames_dropped(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_conversion_p50_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the conversionP50Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_conversion_p50_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_conversion_p95_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the conversionP95Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_conversion_p95_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_conversion_p99_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the conversionP99Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_conversion_p99_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_copy_p50_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the copyP50Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_copy_p50_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_copy_p95_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the copyP95Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_copy_p95_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_copy_p99_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the copyP99Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_copy_p99_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_lateness_p50_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the latenessP50Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_lateness_p50_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_lateness_p95_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the latenessP95Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_lateness_p95_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_lateness_p99_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the latenessP99Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_lateness_p99_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_audio_filter_p50_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the audioFilterP50Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_audio_filter_p50_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_audio_filter_p95_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the audioFilterP95Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_audio_filter_p95_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * av_player_render_stats_message_get_audio_filter_p99_us
+ * @object: a #AvPlayerRenderStatsMessage.
+ *
+ * Gets the value of the audioFilterP99Us field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_render_stats_message_get_audio_filter_p99_us(AvPlayerRenderStatsMessage* object);
+
+/**
+ * AvPlayerCreateResultMessage:
+ *
+ */
+
+G_DECLARE_FINAL_TYPE(AvPlayerCreateResultMessage, av_player_create_result_message, AV_PLAYER, CREATE_RESULT_MESSAGE, GObject)
+
+/**
+ * av_player_create_result_message_new:
+ * player_id: field in this object.
+ * create_latency_us: field in this object.
+ *
+ * Creates a new #CreateResultMessage object.
+ *
+ * Returns: a new #AvPlayerCreateResultMessage
+ */
+AvPlayerCreateResultMessage* av_player_create_result_message_new(int64_t player_id, int64_t create_latency_us);
+
+/**
+ * av_player_create_result_message_get_player_id
+ * @object: a #AvPlayerCreateResultMessage.
+ *
+ * Gets the value of the playerId field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_create_result_message_get_player_id(AvPlayerCreateResultMessage* object);
+
+/**
+ * av_player_create_result_message_get_create_latency_us
+ * @object: a #AvPlayerCreateResultMessage.
+ *
+ * Gets the value of the createLatencyUs field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_create_result_message_get_create_latency_us(AvPlayerCreateResultMessage* object);
+
+/**
+ * AvPlayerClockAnchorMessage:
+ *
+ */
+
+G_DECLARE_FINAL_TYPE(AvPlayerClockAnchorMessage, av_player_clock_anchor_message, AV_PLAYER, CLOCK_ANCHOR_MESSAGE, GObject)
+
+/**
+ * av_player_clock_anchor_message_new:
+ * player_id: field in this object.
+ * position_ms: field in this object.
+ * rate: field in this object.
+ * timestamp_us: field in this object.
+ *
+ * Creates a new #ClockAnchorMessage object.
+ *
+ * Returns: a new #AvPlayerClockAnchorMessage
+ */
+AvPlayerClockAnchorMessage* av_player_clock_anchor_message_new(int64_t player_id, int64_t position_ms, double rate, int64_t timestamp_us);
+
+/**
+ * av_player_clock_anchor_message_get_player_id
+ * @object: a #AvPlayerClockAnchorMessage.
+ *
+ * Gets the value of the playerId field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_clock_anchor_message_get_player_id(AvPlayerClockAnchorMessage* object);
+
+/**
+ * av_player_clock_anchor_message_get_position_ms
+ * @object: a #AvPlayerClockAnchorMessage.
+ *
+ * Gets the value of the positionMs field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_clock_anchor_message_get_position_ms(AvPlayerClockAnchorMessage* object);
+
+/**
+ * av_player_clock_anchor_message_get_rate
+ * @object: a #AvPlayerClockAnchorMessage.
+ *
+ * Gets the value of the rate field of @object.
+ *
+ * Returns: the field value.
+ */
+double av_player_clock_anchor_message_get_rate(AvPlayerClockAnchorMessage* object);
+
+/**
+ * av_player_clock_anchor_message_get_timestamp_us
+ * @object: a #AvPlayerClockAnchorMessage.
+ *
+ * Gets the value of the timestampUs field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_clock_anchor_message_get_timestamp_us(AvPlayerClockAnchorMessage* object);
+
+/**
+ * AvPlayerStateUpdateMessage:
+ *
+ */
+
+G_DECLARE_FINAL_TYPE(AvPlayerStateUpdateMessage, av_player_state_update_message, AV_PLAYER, STATE_UPDATE_MESSAGE, GObject)
+
+/**
+ * av_player_state_update_message_new:
+ * player_id: field in this object.
+ * buffered_ms: field in this object.
+ *
+ * Creates a new #StateUpdateMessage object.
+ *
+ * Returns: a new #AvPlayerStateUpdateMessage
+ */
+AvPlayerStateUpdateMessage* av_player_state_update_message_new(int64_t player_id, int64_t buffered_ms);
+
+/**
+ * av_player_state_update_message_get_player_id
+ * @object: a #AvPlayerStateUpdateMessage.
+ *
+ * Gets the value of the playerId field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_state_update_message_get_player_id(AvPlayerStateUpdateMessage* object);
+
+/**
+ * av_player_state_update_message_get_buffered_ms
+ * @object: a #AvPlayerStateUpdateMessage.
+ *
+ * Gets the value of the bufferedMs field of @object.
+ *
+ * Returns: the field value.
+ */
+int64_t av_player_state_update_message_get_buffered_ms(AvPlayerStateUpdateMessage* object);
+
 G_DECLARE_FINAL_TYPE(AvPlayerMessageCodec, av_player_message_codec, AV_PLAYER, MESSAGE_CODEC, FlStandardMessageCodec)
 
 G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerHostApi, av_player_av_player_host_api, AV_PLAYER, AV_PLAYER_HOST_API, GObject)
@@ -478,7 +810,7 @@ typedef struct {
   void (*dispose)(int64_t player_id, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
   void (*play)(int64_t player_id, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
   void (*pause)(int64_t player_id, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
-  void (*seek_to)(int64_t player_id, int64_t position_ms, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*seek_to)(int64_t player_id, int64_t position_ms, AvPlayerSeekMode mode, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
   void (*set_playback_speed)(int64_t player_id, double speed, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
   void (*set_looping)(int64_t player_id, gboolean looping, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
   void (*set_volume)(int64_t player_id, double volume, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
@@ -496,6 +828,14 @@ typedef struct {
   void (*get_decoder_info)(int64_t player_id, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
   void (*get_subtitle_tracks)(int64_t player_id, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
   void (*select_subtitle_track)(AvPlayerSelectSubtitleTrackRequest* request, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_render_size)(int64_t player_id, int64_t width, int64_t height, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_native_color_conversion)(int64_t player_id, gboolean enabled, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_conversion_threads)(int64_t player_id, int64_t threads, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*get_render_stats)(int64_t player_id, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*get_keyframes)(int64_t player_id, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*queue_next)(int64_t player_id, AvPlayerVideoSourceMessage* source, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*preload)(AvPlayerVideoSourceMessage* source, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_source)(int64_t player_id, AvPlayerVideoSourceMessage* source, AvPlayerAvPlayerHostApiResponseHandle* response_handle, gpointer user_data);
 } AvPlayerAvPlayerHostApiVTable;
 
 /**
@@ -528,7 +868,7 @@ void av_player_av_player_host_api_clear_method_handlers(FlBinaryMessenger* messe
  *
  * Responds to AvPlayerHostApi.create. 
  */
-void av_player_av_player_host_api_respond_create(AvPlayerAvPlayerHostApiResponseHandle* response_handle, int64_t return_value);
+void av_player_av_player_host_api_respond_create(AvPlayerAvPlayerHostApiResponseHandle* response_handle, AvPlayerCreateResultMessage* return_value);
 
 /**
  * av_player_av_player_host_api_respond_error_create:
@@ -945,6 +1285,310 @@ void av_player_av_player_host_api_respond_select_subtitle_track(AvPlayerAvPlayer
  */
 void av_player_av_player_host_api_respond_error_select_subtitle_track(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
 
+/**
+ * av_player_av_player_host_api_respond_set_render_size:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ *
+ * Responds to AvPlayerHostApi.setRenderSize. 
+ */
+void av_player_av_player_host_api_respond_set_render_size(AvPlayerAvPlayerHostApiResponseHandle* response_handle);
+
+/**
+ * av_player_av_player_host_api_respond_error_set_render_size:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.setRenderSize. 
+ */
+void av_player_av_player_host_api_respond_error_set_render_size(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * av_player_av_player_host_api_respond_set_native_color_conversion:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ *
+ * Responds to AvPlayerHostApi.setNativeColorConversion. 
+ */
+void av_player_av_player_host_api_respond_set_native_color_conversion(AvPlayerAvPlayerHostApiResponseHandle* response_handle);
+
+/**
+ * av_player_av_player_host_api_respond_error_set_native_color_conversion:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.setNativeColorConversion. 
+ */
+void av_player_av_player_host_api_respond_error_set_native_color_conversion(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * av_player_av_player_host_api_respond_set_conversion_threads:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ *
+ * Responds to AvPlayerHostApi.setConversionThreads. 
+ */
+void av_player_av_player_host_api_respond_set_conversion_threads(AvPlayerAvPlayerHostApiResponseHandle* response_handle);
+
+/**
+ * av_player_av_player_host_api_respond_error_set_conversion_threads:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.setConversionThreads. 
+ */
+void av_player_av_player_host_api_respond_error_set_conversion_threads(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * av_player_av_player_host_api_respond_get_render_stats:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to AvPlayerHostApi.getRenderStats. 
+ */
+void av_player_av_player_host_api_respond_get_render_stats(AvPlayerAvPlayerHostApiResponseHandle* response_handle, AvPlayerRenderStatsMessage* return_value);
+
+/**
+ * av_player_av_player_host_api_respond_error_get_render_stats:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.getRenderStats. 
+ */
+void av_player_av_player_host_api_respond_error_get_render_stats(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * av_player_av_player_host_api_respond_get_keyframes:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to AvPlayerHostApi.getKeyframes. 
+ */
+void av_player_av_player_host_api_respond_get_keyframes(AvPlayerAvPlayerHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * av_player_av_player_host_api_respond_error_get_keyframes:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.getKeyframes. 
+ */
+void av_player_av_player_host_api_respond_error_get_keyframes(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * av_player_av_player_host_api_respond_queue_next:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to AvPlayerHostApi.queueNext. 
+ */
+void av_player_av_player_host_api_respond_queue_next(AvPlayerAvPlayerHostApiResponseHandle* response_handle, gboolean return_value);
+
+/**
+ * av_player_av_player_host_api_respond_error_queue_next:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.queueNext. 
+ */
+void av_player_av_player_host_api_respond_error_queue_next(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * av_player_av_player_host_api_respond_preload:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ *
+ * Responds to AvPlayerHostApi.preload. 
+ */
+void av_player_av_player_host_api_respond_preload(AvPlayerAvPlayerHostApiResponseHandle* response_handle);
+
+/**
+ * av_player_av_player_host_api_respond_error_preload:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.preload. 
+ */
+void av_player_av_player_host_api_respond_error_preload(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * av_player_av_player_host_api_respond_set_source:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to AvPlayerHostApi.setSource. 
+ */
+void av_player_av_player_host_api_respond_set_source(AvPlayerAvPlayerHostApiResponseHandle* response_handle, gboolean return_value);
+
+/**
+ * av_player_av_player_host_api_respond_error_set_source:
+ * @response_handle: a #AvPlayerAvPlayerHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to AvPlayerHostApi.setSource. 
+ */
+void av_player_av_player_host_api_respond_error_set_source(AvPlayerAvPlayerHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerEventApiOnClockAnchorResponse, av_player_av_player_event_api_on_clock_anchor_response, AV_PLAYER, AV_PLAYER_EVENT_API_ON_CLOCK_ANCHOR_RESPONSE, GObject)
+
+/**
+ * av_player_av_player_event_api_on_clock_anchor_response_is_error:
+ * @response: a #AvPlayerAvPlayerEventApiOnClockAnchorResponse.
+ *
+ * Checks if a response to AvPlayerEventApi.onClockAnchor is an error.
+ *
+ * Returns: a %TRUE if this response is an error.
+ */
+gboolean av_player_av_player_event_api_on_clock_anchor_response_is_error(AvPlayerAvPlayerEventApiOnClockAnchorResponse* response);
+
+/**
+ * av_player_av_player_event_api_on_clock_anchor_response_get_error_code:
+ * @response: a #AvPlayerAvPlayerEventApiOnClockAnchorResponse.
+ *
+ * Get the error code for this response.
+ *
+ * Returns: an error code or %NULL if not an error.
+ */
+const gchar* av_player_av_player_event_api_on_clock_anchor_response_get_error_code(AvPlayerAvPlayerEventApiOnClockAnchorResponse* response);
+
+/**
+ * av_player_av_player_event_api_on_clock_anchor_response_get_error_message:
+ * @response: a #AvPlayerAvPlayerEventApiOnClockAnchorResponse.
+ *
+ * Get the error message for this response.
+ *
+ * Returns: an error message.
+ */
+const gchar* av_player_av_player_event_api_on_clock_anchor_response_get_error_message(AvPlayerAvPlayerEventApiOnClockAnchorResponse* response);
+
+/**
+ * av_player_av_player_event_api_on_clock_anchor_response_get_error_details:
+ * @response: a #AvPlayerAvPlayerEventApiOnClockAnchorResponse.
+ *
+ * Get the error details for this response.
+ *
+ * Returns: (allow-none): an error details or %NULL.
+ */
+FlValue* av_player_av_player_event_api_on_clock_anchor_response_get_error_details(AvPlayerAvPlayerEventApiOnClockAnchorResponse* response);
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerEventApiOnStateUpdateResponse, av_player_av_player_event_api_on_state_update_response, AV_PLAYER, AV_PLAYER_EVENT_API_ON_STATE_UPDATE_RESPONSE, GObject)
+
+/**
+ * av_player_av_player_event_api_on_state_update_response_is_error:
+ * @response: a #AvPlayerAvPlayerEventApiOnStateUpdateResponse.
+ *
+ * Checks if a response to AvPlayerEventApi.onStateUpdate is an error.
+ *
+ * Returns: a %TRUE if this response is an error.
+ */
+gboolean av_player_av_player_event_api_on_state_update_response_is_error(AvPlayerAvPlayerEventApiOnStateUpdateResponse* response);
+
+/**
+ * av_player_av_player_event_api_on_state_update_response_get_error_code:
+ * @response: a #AvPlayerAvPlayerEventApiOnStateUpdateResponse.
+ *
+ * Get the error code for this response.
+ *
+ * Returns: an error code or %NULL if not an error.
+ */
+const gchar* av_player_av_player_event_api_on_state_update_response_get_error_code(AvPlayerAvPlayerEventApiOnStateUpdateResponse* response);
+
+/**
+ * av_player_av_player_event_api_on_state_update_response_get_error_message:
+ * @response: a #AvPlayerAvPlayerEventApiOnStateUpdateResponse.
+ *
+ * Get the error message for this response.
+ *
+ * Returns: an error message.
+ */
+const gchar* av_player_av_player_event_api_on_state_update_response_get_error_message(AvPlayerAvPlayerEventApiOnStateUpdateResponse* response);
+
+/**
+ * av_player_av_player_event_api_on_state_update_response_get_error_details:
+ * @response: a #AvPlayerAvPlayerEventApiOnStateUpdateResponse.
+ *
+ * Get the error details for this response.
+ *
+ * Returns: (allow-none): an error details or %NULL.
+ */
+FlValue* av_player_av_player_event_api_on_state_update_response_get_error_details(AvPlayerAvPlayerEventApiOnStateUpdateResponse* response);
+
+/**
+ * AvPlayerAvPlayerEventApi:
+ *
+ */
+
+G_DECLARE_FINAL_TYPE(AvPlayerAvPlayerEventApi, av_player_av_player_event_api, AV_PLAYER, AV_PLAYER_EVENT_API, GObject)
+
+/**
+ * av_player_av_player_event_api_new:
+ * @messenger: an #FlBinaryMessenger.
+ * @suffix: (allow-none): a suffix to add to the API or %NULL for none.
+ *
+ * Creates a new object to access the AvPlayerEventApi API.
+ *
+ * Returns: a new #AvPlayerAvPlayerEventApi
+ */
+AvPlayerAvPlayerEventApi* av_player_av_player_event_api_new(FlBinaryMessenger* messenger, const gchar* suffix);
+
+/**
+ * av_player_av_player_event_api_on_clock_anchor:
+ * @api: a #AvPlayerAvPlayerEventApi.
+ * @anchor: parameter for this method.
+ * @cancellable: (allow-none): a #GCancellable or %NULL.
+ * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
+ * @user_data: (closure): user data to pass to @callback.
+ *
+ */
+void av_player_av_player_event_api_on_clock_anchor(AvPlayerAvPlayerEventApi* api, AvPlayerClockAnchorMessage* anchor, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * av_player_av_player_event_api_on_clock_anchor_finish:
+ * @api: a #AvPlayerAvPlayerEventApi.
+ * @result: a #GAsyncResult.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ *
+ * Completes a av_player_av_player_event_api_on_clock_anchor() call.
+ *
+ * Returns: a #AvPlayerAvPlayerEventApiOnClockAnchorResponse or %NULL on error.
+ */
+AvPlayerAvPlayerEventApiOnClockAnchorResponse* av_player_av_player_event_api_on_clock_anchor_finish(AvPlayerAvPlayerEventApi* api, GAsyncResult* result, GError** error);
+
+/**
+ * av_player_av_player_event_api_on_state_update:
+ * @api: a #AvPlayerAvPlayerEventApi.
+ * @update: parameter for this method.
+ * @cancellable: (allow-none): a #GCancellable or %NULL.
+ * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
+ * @user_data: (closure): user data to pass to @callback.
+ *
+ */
+void av_player_av_player_event_api_on_state_update(AvPlayerAvPlayerEventApi* api, AvPlayerStateUpdateMessage* update, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * av_player_av_player_event_api_on_state_update_finish:
+ * @api: a #AvPlayerAvPlayerEventApi.
+ * @result: a #GAsyncResult.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ *
+ * Completes a av_player_av_player_event_api_on_state_update() call.
+ *
+ * Returns: a #AvPlayerAvPlayerEventApiOnStateUpdateResponse or %NULL on error.
+ */
+AvPlayerAvPlayerEventApiOnStateUpdateResponse* av_player_av_player_event_api_on_state_update_finish(AvPlayerAvPlayerEventApi* api, GAsyncResult* result, GError** error);
+
 G_END_DECLS
 
 #endif  // PIGEON_MESSAGES_G_H_
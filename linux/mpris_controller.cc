@@ -58,8 +58,13 @@ struct _MprisController {
   MprisCommandCallback callback;
   gpointer user_data;
 
-  gchar* playback_status;
+  // Interned, so it can be swapped from any thread. Atomic.
+  const gchar* playback_status;
+  // Last clock anchor. Guarded by position_lock.
+  GMutex position_lock;
   gint64 position_us;
+  double rate;
+  gint64 position_time_us;
 
   gchar* meta_title;
   gchar* meta_artist;
@@ -67,6 +72,16 @@ struct _MprisController {
   gchar* meta_art_url;
 };
 
+// Position now, extrapolated from the last one set.
+static gint64 current_position_us(MprisController* ctrl) {
+  g_mutex_lock(&ctrl->position_lock);
+  gint64 elapsed_us = g_get_monotonic_time() - ctrl->position_time_us;
+  gint64 position_us =
+      ctrl->position_us + static_cast<gint64>(elapsed_us * ctrl->rate);
+  g_mutex_unlock(&ctrl->position_lock);
+  return position_us > 0 ? position_us : 0;
+}
+
 // =============================================================================
 // D-Bus method handlers
 // =============================================================================
@@ -86,10 +101,9 @@ static void handle_player_method(GDBusConnection* conn,
   } else if (strcmp(method_name, "Pause") == 0) {
     if (ctrl->callback) ctrl->callback("pause", 0, ctrl->user_data);
   } else if (strcmp(method_name, "PlayPause") == 0) {
-    const gchar* cmd =
-        (ctrl->playback_status && strcmp(ctrl->playback_status, "Playing") == 0)
-            ? "pause"
-            : "play";
+    const gchar* status = static_cast<const gchar*>(
+        g_atomic_pointer_get(&ctrl->playback_status));
+    const gchar* cmd = strcmp(status, "Playing") == 0 ? "pause" : "play";
     if (ctrl->callback) ctrl->callback(cmd, 0, ctrl->user_data);
   } else if (strcmp(method_name, "Next") == 0) {
     if (ctrl->callback) ctrl->callback("next", 0, ctrl->user_data);
@@ -101,7 +115,7 @@ static void handle_player_method(GDBusConnection* conn,
     gint64 offset_us = 0;
     g_variant_get(parameters, "(x)", &offset_us);
     // Convert seek offset (microseconds) to absolute position (milliseconds)
-    gint64 new_pos_ms = (ctrl->position_us + offset_us) / 1000;
+    gint64 new_pos_ms = (current_position_us(ctrl) + offset_us) / 1000;
     if (new_pos_ms < 0) new_pos_ms = 0;
     if (ctrl->callback) ctrl->callback("seekTo", new_pos_ms, ctrl->user_data);
   } else if (strcmp(method_name, "SetPosition") == 0) {
@@ -168,11 +182,12 @@ static GVariant* get_player_property(GDBusConnection* conn,
   auto* ctrl = static_cast<MprisController*>(user_data);
 
   if (strcmp(property_name, "PlaybackStatus") == 0)
-    return g_variant_new_string(ctrl->playback_status ? ctrl->playback_status : "Stopped");
+    return g_variant_new_string(static_cast<const gchar*>(
+        g_atomic_pointer_get(&ctrl->playback_status)));
   if (strcmp(property_name, "Metadata") == 0)
     return build_metadata(ctrl);
   if (strcmp(property_name, "Position") == 0)
-    return g_variant_new_int64(ctrl->position_us);
+    return g_variant_new_int64(current_position_us(ctrl));
   if (strcmp(property_name, "CanGoNext") == 0)
     return g_variant_new_boolean(TRUE);
   if (strcmp(property_name, "CanGoPrevious") == 0)
@@ -295,7 +310,8 @@ MprisController* mpris_controller_new(MprisCommandCallback callback,
   auto* ctrl = g_new0(MprisController, 1);
   ctrl->callback = callback;
   ctrl->user_data = user_data;
-  ctrl->playback_status = g_strdup("Stopped");
+  ctrl->playback_status = g_intern_static_string("Stopped");
+  g_mutex_init(&ctrl->position_lock);
   ctrl->position_us = 0;
 
   ctrl->introspection_data = g_dbus_node_info_new_for_xml(kMprisIntrospection, nullptr);
@@ -329,11 +345,11 @@ void mpris_controller_free(MprisController* controller) {
   if (controller->introspection_data)
     g_dbus_node_info_unref(controller->introspection_data);
 
-  g_free(controller->playback_status);
   g_free(controller->meta_title);
   g_free(controller->meta_artist);
   g_free(controller->meta_album);
   g_free(controller->meta_art_url);
+  g_mutex_clear(&controller->position_lock);
   g_free(controller);
 }
 
@@ -367,8 +383,7 @@ void mpris_controller_set_playback_status(MprisController* controller,
                                            const gchar* status) {
   if (controller == nullptr) return;
 
-  g_free(controller->playback_status);
-  controller->playback_status = g_strdup(status);
+  g_atomic_pointer_set(&controller->playback_status, g_intern_string(status));
 
   if (controller->connection != nullptr) {
     GVariantBuilder builder;
@@ -381,7 +396,13 @@ void mpris_controller_set_playback_status(MprisController* controller,
 }
 
 void mpris_controller_set_position(MprisController* controller,
-                                    gint64 position_us) {
+                                    gint64 position_us,
+                                    double rate,
+                                    gint64 timestamp_us) {
   if (controller == nullptr) return;
+  g_mutex_lock(&controller->position_lock);
   controller->position_us = position_us;
+  controller->rate = rate;
+  controller->position_time_us = timestamp_us;
+  g_mutex_unlock(&controller->position_lock);
 }
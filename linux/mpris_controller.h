@@ -29,11 +29,16 @@ void mpris_controller_set_metadata(MprisController* controller,
                                     const gchar* art_url);
 
 // Update the PlaybackStatus property ("Playing", "Paused", "Stopped").
+// Any thread.
 void mpris_controller_set_playback_status(MprisController* controller,
                                            const gchar* status);
 
-// Update the Position property (microseconds, per MPRIS spec).
+// Update the Position property (microseconds, per MPRIS spec) from a clock
+// anchor: |position_us| at monotonic |timestamp_us|, advancing at |rate|.
+// Reads extrapolate from it. Any thread.
 void mpris_controller_set_position(MprisController* controller,
-                                    gint64 position_us);
+                                    gint64 position_us,
+                                    double rate,
+                                    gint64 timestamp_us);
 
 #endif  // MPRIS_CONTROLLER_H_
@@ -2,18 +2,63 @@
 
 #include <gst/video/video.h>
 
+#include <cmath>
 #include <cstring>
+#include <ctime>
+#include <string>
+
+#include "control_thread.h"
+#include "frame_buffer_pool.h"
+#include "frame_copy.h"
+#include "keyframe_index.h"
+#include "latency_histogram.h"
+#include "yuv_converter.h"
 
 // =============================================================================
 // Pixel buffer texture (FlPixelBufferTexture subclass)
 // =============================================================================
 
-struct _AvPipTexture {
-  FlPixelBufferTexture parent_instance;
-  uint8_t* buffer;
+// Lock-free triple buffer: the streaming thread fills the write slot and
+// publishes it with an atomic swap; the raster thread swaps it into its read
+// slot in copy_pixels. A slot holds a copy, or a mapped packed-RGBA sample.
+//
+// The newest frame always wins: one published while another is still pending
+// replaces it, and the replaced one counts as dropped. Only once
+// kMaxReplacedFrames frames in a row were replaced unseen, so the engine is
+// not drawing the texture at all (hidden or minimized), are new frames skipped
+// before any work; preroll and DISCONT frames never are. The newest skipped
+// frame is kept and published at EOS, so the stream never ends on an older
+// picture.
+
+typedef struct {
+  uint8_t* buffer;      // copy target from the frame buffer pool
+  size_t buffer_capacity;
+  GstSample* sample;    // retained sample of a zero-copy frame
+  GstVideoFrame video_frame;
+  const uint8_t* pixels;
   int32_t width;
   int32_t height;
-  GMutex mutex;
+} AvPipFrame;
+
+// ready_state packs the index of the last published slot in the low bits and
+// kFrameFresh while the raster thread has not picked it up yet.
+static const gint kFrameIndexMask = 0x3;
+static const gint kFrameFresh = 0x4;
+
+static const gint kMaxReplacedFrames = 8;
+
+struct _AvPipTexture {
+  FlPixelBufferTexture parent_instance;
+  AvPipFrame frames[3];
+  gint write_index;      // streaming thread only
+  gint read_index;       // raster thread only
+  gint ready_state;      // shared, atomic
+  gint replaced_in_row;  // streaming thread only
+
+  // Frame accounting, each written by one thread and read atomically.
+  gint frames_decoded;    // streaming thread: samples handed to the texture
+  gint frames_dropped;    // streaming thread: frames skipped or replaced
+  gint frames_presented;  // raster thread: fresh frames the engine picked up
 };
 
 #define AV_PIP_TEXTURE(obj) \
@@ -22,31 +67,140 @@ struct _AvPipTexture {
 G_DECLARE_FINAL_TYPE(AvPipTexture, av_pip_texture, AV_PIP, TEXTURE,
                      FlPixelBufferTexture)
 
+static gint atomic_int_exchange(gint* atomic, gint value) {
+  gint old_value;
+  do {
+    old_value = g_atomic_int_get(atomic);
+  } while (!g_atomic_int_compare_and_exchange(atomic, old_value, value));
+  return old_value;
+}
+
+static void av_pip_frame_release_sample(AvPipFrame* frame) {
+  if (frame->sample == nullptr) return;
+  gst_video_frame_unmap(&frame->video_frame);
+  gst_sample_unref(frame->sample);
+  frame->sample = nullptr;
+  frame->pixels = nullptr;
+}
+
+// Returns the write slot resized for a width x height RGBA frame.
+// Streaming thread only.
+static uint8_t* av_pip_texture_begin_frame(AvPipTexture* self,
+                                           int32_t width,
+                                           int32_t height) {
+  AvPipFrame* frame = &self->frames[self->write_index];
+  av_pip_frame_release_sample(frame);
+  // The buffer is kept while the frame stays in its size class, and swapped
+  // through the shared pool (never just grown) when the resolution changes.
+  size_t capacity =
+      frame_buffer_pool_capacity(static_cast<size_t>(width) * height * 4);
+  if (frame->buffer == nullptr || frame->buffer_capacity != capacity) {
+    frame_buffer_pool_release(frame->buffer, frame->buffer_capacity);
+    frame->buffer = frame_buffer_pool_acquire(capacity);
+    frame->buffer_capacity = capacity;
+  }
+  frame->pixels = frame->buffer;
+  frame->width = width;
+  frame->height = height;
+  return frame->buffer;
+}
+
+// Points the write slot at |sample|'s memory if its rows are packed and the
+// engine has taken the last frame. Streaming thread only.
+//
+// Decoders such as v4l2 and vaapi have only a few buffers, so the texture
+// holds at most two: the frame on screen and the one just published. A frame
+// that would replace a pending one is copied instead, so the frame left
+// pending while new ones are skipped is a copy and the skipped sample is the
+// second buffer.
+static gboolean av_pip_texture_attach_sample(AvPipTexture* self,
+                                             GstSample* sample,
+                                             const GstVideoInfo* info) {
+  gint ready_state = g_atomic_int_get(&self->ready_state);
+  if (ready_state & kFrameFresh) return FALSE;
+  // With nothing pending, the ready slot is the one the engine swapped out,
+  // and only a publish from this thread hands it back, so its sample can go.
+  av_pip_frame_release_sample(&self->frames[ready_state & kFrameIndexMask]);
+
+  AvPipFrame* frame = &self->frames[self->write_index];
+  av_pip_frame_release_sample(frame);
+  if (!gst_video_frame_map(&frame->video_frame, info,
+                           gst_sample_get_buffer(sample), GST_MAP_READ)) {
+    return FALSE;
+  }
+  int32_t width = GST_VIDEO_FRAME_WIDTH(&frame->video_frame);
+  if (GST_VIDEO_FRAME_PLANE_STRIDE(&frame->video_frame, 0) != width * 4) {
+    gst_video_frame_unmap(&frame->video_frame);
+    return FALSE;
+  }
+  frame->sample = gst_sample_ref(sample);
+  frame->pixels = static_cast<const uint8_t*>(
+      GST_VIDEO_FRAME_PLANE_DATA(&frame->video_frame, 0));
+  frame->width = width;
+  frame->height = GST_VIDEO_FRAME_HEIGHT(&frame->video_frame);
+  return TRUE;
+}
+
+// Whether the last published frame is still waiting for the engine.
+static gboolean av_pip_texture_frame_pending(AvPipTexture* self) {
+  return (g_atomic_int_get(&self->ready_state) & kFrameFresh) != 0;
+}
+
+// Publishes the write slot as the newest frame and takes back whichever slot
+// was ready before. Streaming thread only.
+static void av_pip_texture_publish_frame(AvPipTexture* self) {
+  gint previous = atomic_int_exchange(&self->ready_state,
+                                      self->write_index | kFrameFresh);
+  self->write_index = previous & kFrameIndexMask;
+  if (previous & kFrameFresh) {
+    // Replaced before the engine saw it.
+    self->replaced_in_row++;
+    g_atomic_int_inc(&self->frames_dropped);
+  } else {
+    self->replaced_in_row = 0;
+  }
+
+  // The returned slot is no longer visible to the raster thread, so a sample
+  // it still holds can go back to the upstream pool right away.
+  av_pip_frame_release_sample(&self->frames[self->write_index]);
+}
+
 static gboolean av_pip_texture_copy_pixels(FlPixelBufferTexture* texture,
                                             const uint8_t** out_buffer,
                                             uint32_t* width,
                                             uint32_t* height,
                                             GError** error) {
   AvPipTexture* self = AV_PIP_TEXTURE(texture);
-  g_mutex_lock(&self->mutex);
-  if (self->buffer == nullptr || self->width <= 0 || self->height <= 0) {
-    g_mutex_unlock(&self->mutex);
+
+  // Only the raster thread clears kFrameFresh, so a fresh frame seen here is
+  // still fresh (or newer) by the time of the swap.
+  if (g_atomic_int_get(&self->ready_state) & kFrameFresh) {
+    gint previous = atomic_int_exchange(&self->ready_state, self->read_index);
+    self->read_index = previous & kFrameIndexMask;
+    g_atomic_int_inc(&self->frames_presented);
+  }
+
+  // The read slot stays untouched until the next copy_pixels call, which is
+  // as long as the engine needs the pointer.
+  AvPipFrame* frame = &self->frames[self->read_index];
+  if (frame->pixels == nullptr || frame->width <= 0 || frame->height <= 0) {
     return FALSE;
   }
-  *out_buffer = self->buffer;
-  *width = static_cast<uint32_t>(self->width);
-  *height = static_cast<uint32_t>(self->height);
-  g_mutex_unlock(&self->mutex);
+  *out_buffer = frame->pixels;
+  *width = static_cast<uint32_t>(frame->width);
+  *height = static_cast<uint32_t>(frame->height);
   return TRUE;
 }
 
 static void av_pip_texture_dispose(GObject* object) {
   AvPipTexture* self = AV_PIP_TEXTURE(object);
-  g_mutex_lock(&self->mutex);
-  g_free(self->buffer);
-  self->buffer = nullptr;
-  g_mutex_unlock(&self->mutex);
-  g_mutex_clear(&self->mutex);
+  for (AvPipFrame& frame : self->frames) {
+    av_pip_frame_release_sample(&frame);
+    frame_buffer_pool_release(frame.buffer, frame.buffer_capacity);
+    frame.buffer = nullptr;
+    frame.buffer_capacity = 0;
+    frame.pixels = nullptr;
+  }
   G_OBJECT_CLASS(av_pip_texture_parent_class)->dispose(object);
 }
 
@@ -56,10 +210,21 @@ static void av_pip_texture_class_init(AvPipTextureClass* klass) {
 }
 
 static void av_pip_texture_init(AvPipTexture* self) {
-  g_mutex_init(&self->mutex);
-  self->buffer = nullptr;
-  self->width = 0;
-  self->height = 0;
+  for (AvPipFrame& frame : self->frames) {
+    frame.buffer = nullptr;
+    frame.buffer_capacity = 0;
+    frame.sample = nullptr;
+    frame.pixels = nullptr;
+    frame.width = 0;
+    frame.height = 0;
+  }
+  self->write_index = 0;
+  self->ready_state = 1;
+  self->read_index = 2;
+  self->replaced_in_row = 0;
+  self->frames_decoded = 0;
+  self->frames_dropped = 0;
+  self->frames_presented = 0;
 }
 
 G_DEFINE_TYPE(AvPipTexture, av_pip_texture, fl_pixel_buffer_texture_get_type())
@@ -68,25 +233,128 @@ G_DEFINE_TYPE(AvPipTexture, av_pip_texture, fl_pixel_buffer_texture_get_type())
 // PlayerInstance struct
 // =============================================================================
 
+// Main thread unless marked; the playback state belongs to the control
+// thread (control_thread.h).
 struct _PlayerInstance {
   FlTextureRegistrar* texture_registrar;
   FlEventChannel* event_channel;
+  AvPlayerAvPlayerEventApi* event_api;  // nullptr: everything on the channel
   AvPipTexture* texture;
   int64_t texture_id;
 
-  GstElement* pipeline;   // playbin
-  GstElement* video_sink; // appsink
+  GstElement* pipeline;      // playbin
+  GstElement* video_scale;   // videoscale
+  GstElement* video_convert; // videoconvert
+  GstElement* video_sink;    // appsink
+
+  // Requested render size in physical pixels, 0 for native resolution.
+  int32_t render_width;
+  int32_t render_height;
+
+  // When set, the appsink also accepts 4:2:0 YUV so videoconvert passes it
+  // through and on_new_sample converts straight into the texture slot.
+  gboolean native_conversion;
+
+  // Threads granted for conversion and scaling. Written on the main thread,
+  // read per frame on the streaming thread.
+  gint conversion_threads;
+
+  // Negotiated appsink caps and their parsed layout. Streaming thread only;
+  // reparsed only when the caps change.
+  GstCaps* video_caps;
+  GstVideoInfo video_info;
+
+  // PTS of the last preroll frame, which new-sample skips. Streaming thread.
+  GstClockTime preroll_pts;
+  // Newest frame skipped since the last publish, shown if EOS follows.
+  // Streaming thread.
+  GstSample* skipped_sample;
+
+  // Per-frame render timings, recorded on the streaming thread and read by
+  // player_instance_get_render_stats.
+  LatencyHistogram conversion_latency;  // YUV to RGBA into the texture slot
+  LatencyHistogram copy_latency;        // RGBA attach or row copy
+  LatencyHistogram lateness;            // clock running time minus PTS
+  // CPU time of audioconvert ! scaletempo per buffer, from the audio
+  // streaming thread's clock. -1 while no buffer is inside the filter.
+  LatencyHistogram audio_filter_cpu;
+  gint64 audio_filter_start_us;
+
+  // Built by player_instance_get_keyframes for keyframe_uri, and rebuilt
+  // once uri has moved on. Main thread only.
+  KeyframeIndex* keyframe_index;
+  gchar* keyframe_uri;
+
+  // Gapless queue: next_uri becomes started_uri until STREAM_START.
+  // Guarded by queue_lock.
+  GMutex queue_lock;
+  gchar* uri;
+  gchar* next_uri;
+  gchar* started_uri;
+
+  // Native size of the current stream, cleared on stream-start. Atomic.
+  gint video_size_valid;
+  gint video_width;
+  gint video_height;
+
+  // Seek queue. seek_in_flight is set while the pipeline prerolls;
+  // pending_seek_ms >= 0 is the newest target requested meanwhile.
+  gboolean seek_in_flight;
+  int64_t pending_seek_ms;
+  AvPlayerSeekMode pending_seek_mode;
 
   gboolean is_looping;
   double speed;
+  // speed has not reached the pipeline yet: set before preroll, or while
+  // paused on a pipeline that refused an instant rate change.
+  gboolean rate_pending;
+  // Rate of the segment the pipeline is playing, which decides whether a
+  // new rate can be applied instantly.
+  double segment_rate;
   gboolean is_initialized;
-  gboolean is_disposed;
+  // Set under outbox_lock on the main thread, read anywhere. Atomic.
+  gint is_disposed;
+  // The pipeline posted an error; it will not preroll or play. Atomic.
+  gint has_failed;
   int64_t duration_ms;
 
-  guint position_timer_id;
-
+  // Attached to the control thread's context.
+  GSource* bus_watch;
+  // The initialized pipeline is PLAYING, and playing_cb was told so.
+  // Control thread.
+  gboolean is_playing;
+  PlayerPlayingCallback playing_cb;
+  gpointer playing_cb_data;
+  // Last clock anchor sent and the position the last tick read. Control
+  // thread.
+  gint64 anchor_position_ns;
+  gint64 anchor_time_us;
+  double anchor_rate;
+  gint64 polled_position_ns;
+  // Last buffered end sent in a stateUpdate, -1 if not sent since the last
+  // initialized. Control thread.
+  int64_t sent_buffered_ms;
+
+  // Dart listens on the event channel. Events are only built while it does.
+  // Set and cleared on the control thread, read anywhere. Atomic.
+  gint listening;
+  // Latest state replayed to a new listener. Control thread.
+  const char* playback_state;
+  gchar* error_message;
+
+  // Events waiting for the main thread, which sends them from one idle per
+  // burst. Guarded by outbox_lock, like is_disposed writes.
+  GMutex outbox_lock;
+  GArray* outbox;  // QueuedEvent
+  guint outbox_idle_id;
+  // The pipeline prerolled since the last flush; prerolled_cb runs with it.
+  gboolean prerolled_pending;
+  PlayerPrerolledCallback prerolled_cb;  // main thread
+  gpointer prerolled_cb_data;
+
+  // Created and freed on the main thread, attached and detached on the
+  // control thread, which keeps it up to date.
   MprisController* mpris;
-  gboolean notification_enabled;
 
   gchar* meta_title;
   gchar* meta_artist;
@@ -98,21 +366,206 @@ struct _PlayerInstance {
 // Event helpers
 // =============================================================================
 
-static void send_event(PlayerInstance* inst, FlValue* event) {
-  if (inst->is_disposed || inst->event_channel == nullptr) {
-    fl_value_unref(event);
-    return;
-  }
-  fl_event_channel_send(inst->event_channel, event, nullptr, nullptr);
-  fl_value_unref(event);
-}
-
 static FlValue* make_event(const char* type) {
   FlValue* map = fl_value_new_map();
   fl_value_set_string_take(map, "type", fl_value_new_string(type));
   return map;
 }
 
+// An event for the main thread: a channel map or one typed message.
+struct QueuedEvent {
+  FlValue* map;
+  AvPlayerClockAnchorMessage* anchor;
+  AvPlayerStateUpdateMessage* update;
+};
+
+static void queued_event_clear(gpointer data) {
+  auto* event = static_cast<QueuedEvent*>(data);
+  g_clear_pointer(&event->map, fl_value_unref);
+  g_clear_object(&event->anchor);
+  g_clear_object(&event->update);
+}
+
+static GArray* outbox_new() {
+  GArray* outbox = g_array_new(FALSE, TRUE, sizeof(QueuedEvent));
+  g_array_set_clear_func(outbox, queued_event_clear);
+  return outbox;
+}
+
+static void on_clock_anchor_sent(GObject* object, GAsyncResult* result,
+                                 gpointer user_data) {
+  // Nothing to do with the reply; Dart may not have set up a handler yet.
+  AvPlayerAvPlayerEventApiOnClockAnchorResponse* response =
+      av_player_av_player_event_api_on_clock_anchor_finish(
+          AV_PLAYER_AV_PLAYER_EVENT_API(object), result, nullptr);
+  g_clear_object(&response);
+}
+
+static void on_state_update_sent(GObject* object, GAsyncResult* result,
+                                 gpointer user_data) {
+  AvPlayerAvPlayerEventApiOnStateUpdateResponse* response =
+      av_player_av_player_event_api_on_state_update_finish(
+          AV_PLAYER_AV_PLAYER_EVENT_API(object), result, nullptr);
+  g_clear_object(&response);
+}
+
+// The event channel form of a typed message.
+static FlValue* typed_event_to_map(const QueuedEvent* event) {
+  if (event->anchor != nullptr) {
+    FlValue* map = make_event("clockAnchor");
+    fl_value_set_string_take(
+        map, "position",
+        fl_value_new_int(
+            av_player_clock_anchor_message_get_position_ms(event->anchor)));
+    fl_value_set_string_take(
+        map, "rate",
+        fl_value_new_float(
+            av_player_clock_anchor_message_get_rate(event->anchor)));
+    fl_value_set_string_take(
+        map, "timestamp",
+        fl_value_new_int(
+            av_player_clock_anchor_message_get_timestamp_us(event->anchor)));
+    return map;
+  }
+  FlValue* map = make_event("stateUpdate");
+  fl_value_set_string_take(
+      map, "buffered",
+      fl_value_new_int(
+          av_player_state_update_message_get_buffered_ms(event->update)));
+  return map;
+}
+
+// Main thread.
+static void send_queued_event(PlayerInstance* inst, const QueuedEvent* event) {
+  if (event->map != nullptr) {
+    if (inst->event_channel != nullptr) {
+      fl_event_channel_send(inst->event_channel, event->map, nullptr, nullptr);
+    }
+  } else if (inst->event_api != nullptr) {
+    if (event->anchor != nullptr) {
+      av_player_av_player_event_api_on_clock_anchor(
+          inst->event_api, event->anchor, nullptr, on_clock_anchor_sent,
+          nullptr);
+    } else {
+      av_player_av_player_event_api_on_state_update(
+          inst->event_api, event->update, nullptr, on_state_update_sent,
+          nullptr);
+    }
+  } else if (inst->event_channel != nullptr) {
+    g_autoptr(FlValue) map = typed_event_to_map(event);
+    fl_event_channel_send(inst->event_channel, map, nullptr, nullptr);
+  }
+}
+
+static gboolean flush_outbox(gpointer user_data) {
+  auto* inst = static_cast<PlayerInstance*>(user_data);
+  g_mutex_lock(&inst->outbox_lock);
+  GArray* events = inst->outbox;
+  inst->outbox = outbox_new();
+  inst->outbox_idle_id = 0;
+  gboolean prerolled = inst->prerolled_pending;
+  inst->prerolled_pending = FALSE;
+  g_mutex_unlock(&inst->outbox_lock);
+
+  for (guint i = 0; i < events->len; i++) {
+    send_queued_event(inst, &g_array_index(events, QueuedEvent, i));
+  }
+  g_array_unref(events);
+  // Last: the callback may dispose the player.
+  if (prerolled && inst->prerolled_cb != nullptr) {
+    inst->prerolled_cb(inst, inst->prerolled_cb_data);
+  }
+  return G_SOURCE_REMOVE;
+}
+
+// Queues |event| for the main thread, taking ownership; any thread. A
+// stateUpdate replaces one queued right before it.
+static void queue_event(PlayerInstance* inst, QueuedEvent event) {
+  g_mutex_lock(&inst->outbox_lock);
+  if (g_atomic_int_get(&inst->is_disposed) ||
+      !g_atomic_int_get(&inst->listening)) {
+    g_mutex_unlock(&inst->outbox_lock);
+    queued_event_clear(&event);
+    return;
+  }
+  QueuedEvent* last =
+      inst->outbox->len > 0
+          ? &g_array_index(inst->outbox, QueuedEvent, inst->outbox->len - 1)
+          : nullptr;
+  if (last != nullptr && event.update != nullptr && last->update != nullptr) {
+    g_object_unref(last->update);
+    last->update = event.update;
+  } else {
+    g_array_append_val(inst->outbox, event);
+  }
+  if (inst->outbox_idle_id == 0) {
+    inst->outbox_idle_id = g_idle_add(flush_outbox, inst);
+  }
+  g_mutex_unlock(&inst->outbox_lock);
+}
+
+// Has prerolled_cb run on the main thread, whether or not anyone listens.
+static void notify_prerolled(PlayerInstance* inst) {
+  g_mutex_lock(&inst->outbox_lock);
+  if (!g_atomic_int_get(&inst->is_disposed)) {
+    inst->prerolled_pending = TRUE;
+    if (inst->outbox_idle_id == 0) {
+      inst->outbox_idle_id = g_idle_add(flush_outbox, inst);
+    }
+  }
+  g_mutex_unlock(&inst->outbox_lock);
+}
+
+// Queues an event channel map; any thread.
+static void send_event(PlayerInstance* inst, FlValue* event) {
+  queue_event(inst, QueuedEvent{event, nullptr, nullptr});
+}
+
+// Whether anyone would receive an event; checked before building one.
+static gboolean is_listened(PlayerInstance* inst) {
+  return g_atomic_int_get(&inst->listening);
+}
+
+// MPRIS follows the player whether or not Dart listens. Control thread.
+static void update_mpris_status(PlayerInstance* inst) {
+  if (inst->mpris == nullptr || inst->playback_state == nullptr) return;
+  if (strcmp(inst->playback_state, "playing") == 0) {
+    mpris_controller_set_playback_status(inst->mpris, "Playing");
+  } else if (strcmp(inst->playback_state, "paused") == 0) {
+    mpris_controller_set_playback_status(inst->mpris, "Paused");
+  }
+}
+
+// Control thread.
+static void update_mpris_position(PlayerInstance* inst) {
+  if (inst->mpris == nullptr) return;
+  // Microseconds
+  mpris_controller_set_position(inst->mpris,
+                                inst->anchor_position_ns / GST_USECOND,
+                                inst->anchor_rate, inst->anchor_time_us);
+}
+
+// Records |state| for the listener snapshot and MPRIS, and sends it. Control
+// thread.
+static void send_playback_state(PlayerInstance* inst, const char* state) {
+  inst->playback_state = state;
+  update_mpris_status(inst);
+  if (!is_listened(inst)) return;
+  FlValue* event = make_event("playbackStateChanged");
+  fl_value_set_string_take(event, "state", fl_value_new_string(state));
+  send_event(inst, event);
+}
+
+// Control thread.
+static void send_error(PlayerInstance* inst) {
+  if (!is_listened(inst)) return;
+  FlValue* event = make_event("error");
+  fl_value_set_string_take(event, "message",
+                            fl_value_new_string(inst->error_message));
+  fl_value_set_string_take(event, "code", fl_value_new_string("GST_ERROR"));
+  send_event(inst, event);
+}
+
 // =============================================================================
 // MPRIS command callback
 // =============================================================================
@@ -120,7 +573,7 @@ static FlValue* make_event(const char* type) {
 static void mpris_command_cb(const gchar* command, gint64 seek_position_ms,
                               gpointer user_data) {
   auto* inst = static_cast<PlayerInstance*>(user_data);
-  if (inst->is_disposed) return;
+  if (g_atomic_int_get(&inst->is_disposed) || !is_listened(inst)) return;
 
   FlValue* event = make_event("mediaCommand");
   fl_value_set_string_take(event, "command", fl_value_new_string(command));
@@ -132,90 +585,619 @@ static void mpris_command_cb(const gchar* command, gint64 seek_position_ms,
 }
 
 // =============================================================================
-// GStreamer appsink callback (new-sample)
+// GStreamer appsink callbacks (new-sample, new-preroll, eos)
 // =============================================================================
 
+// Copies an RGBA frame into a packed width * 4 destination, honouring the
+// source plane stride (rows may be padded for alignment).
+static void copy_rgba_rows(uint8_t* dst, const GstVideoFrame* src) {
+  frame_copy_rows(
+      dst, static_cast<const uint8_t*>(GST_VIDEO_FRAME_PLANE_DATA(src, 0)),
+      GST_VIDEO_FRAME_PLANE_STRIDE(src, 0),
+      static_cast<size_t>(GST_VIDEO_FRAME_WIDTH(src)) * 4,
+      GST_VIDEO_FRAME_HEIGHT(src));
+}
+
+// Refreshes the cached video info when the sample carries new caps.
+static gboolean update_video_info(PlayerInstance* inst, GstCaps* caps) {
+  if (caps == nullptr) return FALSE;
+  if (inst->video_caps == caps ||
+      (inst->video_caps != nullptr && gst_caps_is_equal(inst->video_caps, caps))) {
+    return TRUE;
+  }
+  GstVideoInfo info;
+  if (!gst_video_info_from_caps(&info, caps)) return FALSE;
+  inst->video_info = info;
+  gst_caps_replace(&inst->video_caps, caps);
+  return TRUE;
+}
+
+// Describes a mapped 4:2:0 frame for the native converter. Returns FALSE for
+// formats it does not handle.
+static gboolean yuv_frame_from_video_frame(const GstVideoFrame* frame,
+                                           YuvFrame* out) {
+  switch (GST_VIDEO_FRAME_FORMAT(frame)) {
+    case GST_VIDEO_FORMAT_I420:
+      out->format = YUV_FORMAT_I420;
+      break;
+    case GST_VIDEO_FORMAT_NV12:
+      out->format = YUV_FORMAT_NV12;
+      break;
+    case GST_VIDEO_FORMAT_P010_10LE:
+      out->format = YUV_FORMAT_P010;
+      break;
+    default:
+      return FALSE;
+  }
+
+  const GstVideoColorimetry* colorimetry = &GST_VIDEO_INFO_COLORIMETRY(&frame->info);
+  switch (colorimetry->matrix) {
+    case GST_VIDEO_COLOR_MATRIX_BT601:
+      out->matrix = YUV_MATRIX_BT601;
+      break;
+    case GST_VIDEO_COLOR_MATRIX_BT2020:
+      out->matrix = YUV_MATRIX_BT2020;
+      break;
+    case GST_VIDEO_COLOR_MATRIX_BT709:
+      out->matrix = YUV_MATRIX_BT709;
+      break;
+    default:
+      // Same guess as GStreamer for untagged streams: SD is BT.601.
+      out->matrix = GST_VIDEO_FRAME_HEIGHT(frame) >= 720 ? YUV_MATRIX_BT709
+                                                         : YUV_MATRIX_BT601;
+      break;
+  }
+  out->full_range = colorimetry->range == GST_VIDEO_COLOR_RANGE_0_255;
+  out->width = GST_VIDEO_FRAME_WIDTH(frame);
+  out->height = GST_VIDEO_FRAME_HEIGHT(frame);
+  for (guint i = 0; i < 3; i++) {
+    const bool has_plane = i < GST_VIDEO_FRAME_N_PLANES(frame);
+    out->planes[i] = has_plane ? static_cast<const uint8_t*>(
+                                     GST_VIDEO_FRAME_PLANE_DATA(frame, i))
+                               : nullptr;
+    out->strides[i] = has_plane ? GST_VIDEO_FRAME_PLANE_STRIDE(frame, i) : 0;
+  }
+  return TRUE;
+}
+
+// Records how late |sample| reached the texture on the pipeline clock.
+static void record_lateness(PlayerInstance* inst, GstSample* sample) {
+  GstSegment* segment = gst_sample_get_segment(sample);
+  GstClockTime pts = GST_BUFFER_PTS(gst_sample_get_buffer(sample));
+  if (segment == nullptr || !GST_CLOCK_TIME_IS_VALID(pts)) return;
+  GstClockTime running_time =
+      gst_segment_to_running_time(segment, GST_FORMAT_TIME, pts);
+  if (!GST_CLOCK_TIME_IS_VALID(running_time)) return;
+
+  GstClock* clock = gst_element_get_clock(inst->video_sink);
+  if (clock == nullptr) return;
+  GstClockTime now = gst_clock_get_time(clock) -
+                     gst_element_get_base_time(inst->video_sink);
+  gst_object_unref(clock);
+
+  latency_histogram_record(&inst->lateness,
+                           GST_CLOCK_DIFF(running_time, now) /
+                               static_cast<GstClockTimeDiff>(GST_USECOND));
+}
+
+// Publishes |sample| to the texture in place of any pending frame, or skips it
+// while the engine is not picking frames up. Takes ownership of the sample.
+static void present_sample(PlayerInstance* inst,
+                           GstSample* sample,
+                           gboolean preroll) {
+  if (!update_video_info(inst, gst_sample_get_caps(sample))) {
+    gst_sample_unref(sample);
+    return;
+  }
+
+  GstBuffer* buffer = gst_sample_get_buffer(sample);
+  AvPipTexture* tex = inst->texture;
+  g_atomic_int_inc(&tex->frames_decoded);
+
+  if (!preroll && av_pip_texture_frame_pending(tex) &&
+      !GST_BUFFER_FLAG_IS_SET(buffer, GST_BUFFER_FLAG_DISCONT) &&
+      tex->replaced_in_row >= kMaxReplacedFrames) {
+    g_atomic_int_inc(&tex->frames_dropped);
+    if (inst->skipped_sample != nullptr) gst_sample_unref(inst->skipped_sample);
+    inst->skipped_sample = sample;
+    return;
+  }
+  g_clear_pointer(&inst->skipped_sample, gst_sample_unref);
+
+  gboolean published = FALSE;
+  GstVideoFrame frame;
+  gint64 start_us = g_get_monotonic_time();
+
+  if (GST_VIDEO_INFO_FORMAT(&inst->video_info) != GST_VIDEO_FORMAT_RGBA) {
+    // YUV passed through for native conversion: convert straight into the
+    // slot's buffer, which also takes the place of the copy.
+    YuvFrame yuv;
+    if (gst_video_frame_map(&frame, &inst->video_info, buffer, GST_MAP_READ)) {
+      if (yuv_frame_from_video_frame(&frame, &yuv)) {
+        uint8_t* pixels = av_pip_texture_begin_frame(tex, yuv.width, yuv.height);
+        yuv_convert_to_rgba(&yuv, pixels, yuv.width * 4,
+                            static_cast<guint>(g_atomic_int_get(
+                                &inst->conversion_threads)));
+        latency_histogram_record(&inst->conversion_latency,
+                                 g_get_monotonic_time() - start_us);
+        published = TRUE;
+      }
+      gst_video_frame_unmap(&frame);
+    }
+  } else {
+    // Hand the decoded buffer to the engine as-is when its rows are packed;
+    // otherwise copy it row by row into the slot's own buffer.
+    published = av_pip_texture_attach_sample(tex, sample, &inst->video_info);
+
+    if (!published &&
+        gst_video_frame_map(&frame, &inst->video_info, buffer, GST_MAP_READ)) {
+      uint8_t* pixels = av_pip_texture_begin_frame(
+          tex, GST_VIDEO_FRAME_WIDTH(&frame), GST_VIDEO_FRAME_HEIGHT(&frame));
+      copy_rgba_rows(pixels, &frame);
+      gst_video_frame_unmap(&frame);
+      published = TRUE;
+    }
+    if (published) {
+      latency_histogram_record(&inst->copy_latency,
+                               g_get_monotonic_time() - start_us);
+    }
+  }
+
+  if (published) {
+    av_pip_texture_publish_frame(tex);
+    fl_texture_registrar_mark_texture_frame_available(inst->texture_registrar,
+                                                       FL_TEXTURE(tex));
+    // Only frames rendered in PLAYING say anything about lateness.
+    if (!preroll) record_lateness(inst, sample);
+  }
+
+  gst_sample_unref(sample);
+}
+
 static GstFlowReturn on_new_sample(GstAppSink* sink, gpointer user_data) {
   auto* inst = static_cast<PlayerInstance*>(user_data);
-  if (inst->is_disposed) return GST_FLOW_OK;
+  if (g_atomic_int_get(&inst->is_disposed)) return GST_FLOW_OK;
 
   GstSample* sample = gst_app_sink_pull_sample(sink);
   if (sample == nullptr) return GST_FLOW_OK;
 
-  GstBuffer* buffer = gst_sample_get_buffer(sample);
-  GstCaps* caps = gst_sample_get_caps(sample);
-  GstVideoInfo info;
-  if (!gst_video_info_from_caps(&info, caps)) {
+  GstClockTime pts = GST_BUFFER_PTS(gst_sample_get_buffer(sample));
+  if (GST_CLOCK_TIME_IS_VALID(inst->preroll_pts) && pts == inst->preroll_pts) {
+    // Already on screen from preroll.
+    inst->preroll_pts = GST_CLOCK_TIME_NONE;
     gst_sample_unref(sample);
     return GST_FLOW_OK;
   }
+  inst->preroll_pts = GST_CLOCK_TIME_NONE;
+
+  present_sample(inst, sample, FALSE);
+  return GST_FLOW_OK;
+}
+
+// Shows the first frame and the target of every paused seek.
+static GstFlowReturn on_new_preroll(GstAppSink* sink, gpointer user_data) {
+  auto* inst = static_cast<PlayerInstance*>(user_data);
+  if (g_atomic_int_get(&inst->is_disposed)) return GST_FLOW_OK;
+
+  GstSample* sample = gst_app_sink_pull_preroll(sink);
+  if (sample == nullptr) return GST_FLOW_OK;
+
+  inst->preroll_pts = GST_BUFFER_PTS(gst_sample_get_buffer(sample));
+  present_sample(inst, sample, TRUE);
+  return GST_FLOW_OK;
+}
+
+// Publishes the last frame if it was skipped: no newer one will replace it.
+static void on_eos(GstAppSink* sink, gpointer user_data) {
+  auto* inst = static_cast<PlayerInstance*>(user_data);
+  if (g_atomic_int_get(&inst->is_disposed)) return;
+
+  GstSample* sample = inst->skipped_sample;
+  if (sample == nullptr) return;
+  inst->skipped_sample = nullptr;
+  // Undo its count as decoded and dropped, then publish it like a preroll
+  // frame, which is never skipped.
+  g_atomic_int_add(&inst->texture->frames_decoded, -1);
+  g_atomic_int_add(&inst->texture->frames_dropped, -1);
+  present_sample(inst, sample, TRUE);
+}
 
-  int width = GST_VIDEO_INFO_WIDTH(&info);
-  int height = GST_VIDEO_INFO_HEIGHT(&info);
+// =============================================================================
+// Position clock anchors and ticks
+// =============================================================================
+
+// A position moving further from the last anchor than this gets a new one.
+constexpr gint64 kClockDriftNs = 30 * GST_MSECOND;
+
+// Sends a clockAnchor for the current position. Control thread.
+static void send_clock_anchor(PlayerInstance* inst, double rate) {
+  gint64 pos_ns = 0;
+  if (!gst_element_query_position(inst->pipeline, GST_FORMAT_TIME, &pos_ns)) {
+    return;
+  }
+  inst->anchor_position_ns = pos_ns;
+  inst->anchor_time_us = g_get_monotonic_time();
+  inst->anchor_rate = rate;
+  inst->polled_position_ns = pos_ns;
+  update_mpris_position(inst);
+  if (!is_listened(inst)) return;
+
+  queue_event(inst, QueuedEvent{nullptr,
+                                av_player_clock_anchor_message_new(
+                                    inst->texture_id, pos_ns / GST_MSECOND,
+                                    rate, inst->anchor_time_us),
+                                nullptr});
+}
 
-  GstMapInfo map;
-  if (gst_buffer_map(buffer, &map, GST_MAP_READ)) {
-    AvPipTexture* tex = inst->texture;
-    g_mutex_lock(&tex->mutex);
+// Rate the position advances at: the segment rate while the initialized
+// pipeline plays, 0 otherwise.
+static double running_rate(PlayerInstance* inst) {
+  return inst->is_playing ? inst->segment_rate : 0;
+}
 
-    size_t needed = static_cast<size_t>(width) * height * 4;
-    if (tex->width != width || tex->height != height) {
-      g_free(tex->buffer);
-      tex->buffer = static_cast<uint8_t*>(g_malloc(needed));
-      tex->width = width;
-      tex->height = height;
+// Re-anchors when the position stalls, resumes or drifts from the anchor.
+static void check_clock(PlayerInstance* inst) {
+  gint64 pos_ns = 0;
+  if (!gst_element_query_position(inst->pipeline, GST_FORMAT_TIME, &pos_ns)) {
+    return;
+  }
+  gboolean moved = pos_ns != inst->polled_position_ns;
+  inst->polled_position_ns = pos_ns;
+  if (inst->anchor_rate != 0 && !moved) {
+    send_clock_anchor(inst, 0);  // Underrun or end of stream
+  } else if (inst->anchor_rate == 0 && moved) {
+    send_clock_anchor(inst, inst->segment_rate);
+  } else {
+    gint64 elapsed_us = g_get_monotonic_time() - inst->anchor_time_us;
+    gint64 expected_ns =
+        inst->anchor_position_ns +
+        static_cast<gint64>(elapsed_us * GST_USECOND * inst->anchor_rate);
+    if (ABS(pos_ns - expected_ns) > kClockDriftNs) {
+      send_clock_anchor(inst, inst->anchor_rate);
     }
+  }
+}
 
-    size_t copy_size = (map.size < needed) ? map.size : needed;
-    memcpy(tex->buffer, map.data, copy_size);
+// Sends a stateUpdate with the buffered end if it changed since the last
+// one, or nothing. Control thread.
+static void send_state_update(PlayerInstance* inst) {
+  if (!is_listened(inst)) return;
+  GstQuery* query = gst_query_new_buffering(GST_FORMAT_TIME);
+  if (gst_element_query(inst->pipeline, query)) {
+    gint64 start = 0, stop = 0;
+    gst_query_parse_buffering_range(query, nullptr, &start, &stop, nullptr);
+    int64_t buffered_ms = stop / GST_MSECOND;
+    if (stop > 0 && buffered_ms != inst->sent_buffered_ms) {
+      queue_event(inst, QueuedEvent{nullptr, nullptr,
+                                    av_player_state_update_message_new(
+                                        inst->texture_id, buffered_ms)});
+      inst->sent_buffered_ms = buffered_ms;
+    }
+  }
+  gst_query_unref(query);
+}
 
-    g_mutex_unlock(&tex->mutex);
-    gst_buffer_unmap(buffer, &map);
+// Anchors the clock and tells the scheduler. Control thread.
+static void set_playing(PlayerInstance* inst, gboolean playing) {
+  if (playing == inst->is_playing) return;
+  inst->is_playing = playing;
+  if (playing) {
+    send_clock_anchor(inst, inst->segment_rate);
+  } else if (inst->is_initialized) {
+    send_clock_anchor(inst, 0);
+  }
+  if (inst->playing_cb != nullptr) {
+    inst->playing_cb(inst, playing, inst->playing_cb_data);
+  }
+}
 
-    fl_texture_registrar_mark_texture_frame_available(inst->texture_registrar,
-                                                       FL_TEXTURE(tex));
+// =============================================================================
+// Gapless queue
+// =============================================================================
+
+// Streaming thread: continues into the queued URI without a gap.
+static void on_about_to_finish(GstElement* playbin, gpointer user_data) {
+  auto* inst = static_cast<PlayerInstance*>(user_data);
+  g_mutex_lock(&inst->queue_lock);
+  gchar* uri = inst->next_uri;
+  inst->next_uri = nullptr;
+  if (uri != nullptr) {
+    g_free(inst->started_uri);
+    inst->started_uri = g_strdup(uri);
   }
+  g_mutex_unlock(&inst->queue_lock);
 
-  gst_sample_unref(sample);
-  return GST_FLOW_OK;
+  if (uri == nullptr) return;
+  g_object_set(playbin, "uri", uri, nullptr);
+  g_free(uri);
+}
+
+// Tracks the native video size per stream for trackChanged.
+static GstPadProbeReturn on_video_stream_event(GstPad* pad,
+                                               GstPadProbeInfo* info,
+                                               gpointer user_data) {
+  auto* inst = static_cast<PlayerInstance*>(user_data);
+  GstEvent* event = GST_PAD_PROBE_INFO_EVENT(info);
+  if (GST_EVENT_TYPE(event) == GST_EVENT_STREAM_START) {
+    g_atomic_int_set(&inst->video_size_valid, FALSE);
+  } else if (GST_EVENT_TYPE(event) == GST_EVENT_CAPS) {
+    GstCaps* caps = nullptr;
+    gst_event_parse_caps(event, &caps);
+    GstVideoInfo vinfo;
+    if (caps != nullptr && gst_video_info_from_caps(&vinfo, caps)) {
+      g_atomic_int_set(&inst->video_width, GST_VIDEO_INFO_WIDTH(&vinfo));
+      g_atomic_int_set(&inst->video_height, GST_VIDEO_INFO_HEIGHT(&vinfo));
+      g_atomic_int_set(&inst->video_size_valid, TRUE);
+    }
+  }
+  return GST_PAD_PROBE_OK;
+}
+
+// Control thread, on STREAM_START: if playbin switched to a queued URI,
+// makes it the current source and reports the new track.
+static void adopt_started_track(PlayerInstance* inst) {
+  g_mutex_lock(&inst->queue_lock);
+  gchar* uri = inst->started_uri;
+  inst->started_uri = nullptr;
+  if (uri != nullptr) {
+    // The keyframe index notices the new URI on its next use.
+    g_free(inst->uri);
+    inst->uri = uri;
+  }
+  g_mutex_unlock(&inst->queue_lock);
+  if (uri == nullptr) return;
+
+  inst->sent_buffered_ms = -1;
+  inst->duration_ms = 0;
+  gint64 duration_ns = 0;
+  if (gst_element_query_duration(inst->pipeline, GST_FORMAT_TIME, &duration_ns)) {
+    inst->duration_ms = duration_ns / GST_MSECOND;
+  }
+  // The new caps usually follow stream-start before this runs; if not, the
+  // size is reported as unknown rather than the previous track's.
+  gboolean size_valid = g_atomic_int_get(&inst->video_size_valid);
+  int width = size_valid ? g_atomic_int_get(&inst->video_width) : 0;
+  int height = size_valid ? g_atomic_int_get(&inst->video_height) : 0;
+
+  if (is_listened(inst)) {
+    FlValue* event = make_event("trackChanged");
+    fl_value_set_string_take(event, "duration",
+                              fl_value_new_int(inst->duration_ms));
+    fl_value_set_string_take(event, "width",
+                              fl_value_new_float(static_cast<double>(width)));
+    fl_value_set_string_take(event, "height",
+                              fl_value_new_float(static_cast<double>(height)));
+    send_event(inst, event);
+  }
+  send_clock_anchor(inst, running_rate(inst));
+}
+
+// =============================================================================
+// Audio time stretch
+// =============================================================================
+
+// CPU time of the calling thread, in microseconds.
+static gint64 thread_cpu_time_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<gint64>(ts.tv_sec) * G_USEC_PER_SEC + ts.tv_nsec / 1000;
+}
+
+// A buffer enters the filter; the elements run on this thread until
+// scaletempo pushes out what it made of it.
+static GstPadProbeReturn on_audio_filter_in(GstPad* pad,
+                                            GstPadProbeInfo* info,
+                                            gpointer user_data) {
+  auto* inst = static_cast<PlayerInstance*>(user_data);
+  inst->audio_filter_start_us = thread_cpu_time_us();
+  return GST_PAD_PROBE_OK;
+}
+
+static GstPadProbeReturn on_audio_filter_out(GstPad* pad,
+                                             GstPadProbeInfo* info,
+                                             gpointer user_data) {
+  auto* inst = static_cast<PlayerInstance*>(user_data);
+  // The first buffer pushed out ends the measurement of its input. Inputs
+  // scaletempo only accumulates restart it, so their cost is not counted.
+  if (inst->audio_filter_start_us < 0) return GST_PAD_PROBE_OK;
+  latency_histogram_record(&inst->audio_filter_cpu,
+                           thread_cpu_time_us() - inst->audio_filter_start_us);
+  inst->audio_filter_start_us = -1;
+  return GST_PAD_PROBE_OK;
+}
+
+// audioconvert ! scaletempo, so speed changes keep the pitch, with its CPU
+// time per buffer recorded for the render stats. nullptr when scaletempo is
+// not installed.
+static GstElement* make_time_stretch_filter(PlayerInstance* inst) {
+  GstElement* tempo = gst_element_factory_make("scaletempo", nullptr);
+  if (tempo == nullptr) return nullptr;
+  // Decoders may output sample formats scaletempo does not take.
+  GstElement* convert = gst_element_factory_make("audioconvert", nullptr);
+
+  GstElement* bin = gst_bin_new("audio_filter_bin");
+  gst_bin_add_many(GST_BIN(bin), convert, tempo, nullptr);
+  gst_element_link(convert, tempo);
+
+  GstPad* sink_pad = gst_element_get_static_pad(convert, "sink");
+  gst_element_add_pad(bin, gst_ghost_pad_new("sink", sink_pad));
+  gst_pad_add_probe(sink_pad, GST_PAD_PROBE_TYPE_BUFFER, on_audio_filter_in,
+                    inst, nullptr);
+  gst_object_unref(sink_pad);
+  GstPad* src_pad = gst_element_get_static_pad(tempo, "src");
+  gst_element_add_pad(bin, gst_ghost_pad_new("src", src_pad));
+  gst_pad_add_probe(src_pad, GST_PAD_PROBE_TYPE_BUFFER, on_audio_filter_out,
+                    inst, nullptr);
+  gst_object_unref(src_pad);
+  inst->audio_filter_start_us = -1;
+  return bin;
+}
+
+// =============================================================================
+// Seek queue
+// =============================================================================
+
+static GstSeekFlags seek_flags_for_mode(AvPlayerSeekMode mode) {
+  switch (mode) {
+    case AV_PLAYER_SEEK_MODE_KEYFRAME_BEFORE:
+      return static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT |
+                                       GST_SEEK_FLAG_SNAP_BEFORE);
+    case AV_PLAYER_SEEK_MODE_KEYFRAME_AFTER:
+      return static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT |
+                                       GST_SEEK_FLAG_SNAP_AFTER);
+    case AV_PLAYER_SEEK_MODE_NEAREST_KEYFRAME:
+      return static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT |
+                                       GST_SEEK_FLAG_SNAP_NEAREST);
+    case AV_PLAYER_SEEK_MODE_ACCURATE:
+    default:  // unknown values from a newer Dart side seek accurately
+      return static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE);
+  }
+}
+
+// Above this |rate| decoding every frame costs more than it shows, so only
+// keyframes are decoded and audio is skipped.
+constexpr double kTrickModeMinRate = 4.0;
+
+// Segment flags for playing at |rate|.
+static GstSeekFlags trick_flags_for_rate(double rate) {
+  if (fabs(rate) <= kTrickModeMinRate) return GST_SEEK_FLAG_NONE;
+  return static_cast<GstSeekFlags>(GST_SEEK_FLAG_TRICKMODE |
+                                   GST_SEEK_FLAG_TRICKMODE_KEY_UNITS |
+                                   GST_SEEK_FLAG_TRICKMODE_NO_AUDIO);
+}
+
+// Seeks to |pos_ns| at the current speed. Forward segments run from the
+// position to the end; reverse ones from the start back to the position.
+static gboolean seek_at_speed(PlayerInstance* inst,
+                              gint64 pos_ns,
+                              GstSeekFlags flags) {
+  flags = static_cast<GstSeekFlags>(flags | trick_flags_for_rate(inst->speed));
+  gboolean ok;
+  if (inst->speed < 0) {
+    ok = gst_element_seek(inst->pipeline, inst->speed, GST_FORMAT_TIME, flags,
+                          GST_SEEK_TYPE_SET, 0,
+                          GST_SEEK_TYPE_SET, pos_ns);
+  } else {
+    ok = gst_element_seek(inst->pipeline, inst->speed, GST_FORMAT_TIME, flags,
+                          GST_SEEK_TYPE_SET, pos_ns,
+                          GST_SEEK_TYPE_NONE, -1);
+  }
+  if (ok) {
+    inst->segment_rate = inst->speed;
+    inst->rate_pending = FALSE;
+    // A refused seek posts no ASYNC_DONE to wait for.
+    if (flags & GST_SEEK_FLAG_FLUSH) inst->seek_in_flight = TRUE;
+  }
+  return ok;
+}
+
+static void issue_seek(PlayerInstance* inst,
+                       int64_t position_ms,
+                       AvPlayerSeekMode mode) {
+  seek_at_speed(inst, position_ms * GST_MSECOND, seek_flags_for_mode(mode));
+}
+
+// Issues the newest queued seek, if any. Called once the previous one has
+// prerolled.
+static void issue_pending_seek(PlayerInstance* inst) {
+  inst->seek_in_flight = FALSE;
+  if (inst->pending_seek_ms < 0) return;
+  int64_t position_ms = inst->pending_seek_ms;
+  inst->pending_seek_ms = -1;
+  issue_seek(inst, position_ms, inst->pending_seek_mode);
 }
 
 // =============================================================================
 // GStreamer bus message handler
 // =============================================================================
 
+// Sends initialized with the duration and the native video size.
+static void send_initialized_event(PlayerInstance* inst) {
+  if (!is_listened(inst)) return;
+
+  // Query native video dimensions ahead of any render-size scaling
+  int width = 0, height = 0;
+  GstPad* pad = gst_element_get_static_pad(inst->video_scale, "sink");
+  if (pad != nullptr) {
+    GstCaps* caps = gst_pad_get_current_caps(pad);
+    if (caps != nullptr) {
+      GstVideoInfo vinfo;
+      if (gst_video_info_from_caps(&vinfo, caps)) {
+        width = GST_VIDEO_INFO_WIDTH(&vinfo);
+        height = GST_VIDEO_INFO_HEIGHT(&vinfo);
+      }
+      gst_caps_unref(caps);
+    }
+    gst_object_unref(pad);
+  }
+
+  FlValue* event = make_event("initialized");
+  fl_value_set_string_take(event, "duration",
+                            fl_value_new_int(inst->duration_ms));
+  fl_value_set_string_take(event, "width",
+                            fl_value_new_float(static_cast<double>(width)));
+  fl_value_set_string_take(event, "height",
+                            fl_value_new_float(static_cast<double>(height)));
+  fl_value_set_string_take(event, "textureId",
+                            fl_value_new_int(inst->texture_id));
+  send_event(inst, event);
+}
+
+// Sends initialized, the ready state and the preroll position for a
+// prerolled player. The next stateUpdate carries the buffered end again.
+static void send_initialized(PlayerInstance* inst) {
+  inst->sent_buffered_ms = -1;
+  send_initialized_event(inst);
+  send_playback_state(inst, "ready");
+  send_clock_anchor(inst, running_rate(inst));
+}
+
+// Replays the latest state to a listener that just attached.
+static void send_snapshot(PlayerInstance* inst) {
+  if (inst->error_message != nullptr) {
+    send_error(inst);
+    return;
+  }
+  if (!inst->is_initialized) return;
+  inst->sent_buffered_ms = -1;
+  send_initialized_event(inst);
+  send_playback_state(inst, inst->playback_state);
+  send_clock_anchor(inst, running_rate(inst));
+  send_state_update(inst);
+}
+
 static gboolean on_bus_message(GstBus* bus, GstMessage* msg, gpointer user_data) {
   auto* inst = static_cast<PlayerInstance*>(user_data);
-  if (inst->is_disposed) return TRUE;
+  if (g_atomic_int_get(&inst->is_disposed)) return TRUE;
 
   switch (GST_MESSAGE_TYPE(msg)) {
     case GST_MESSAGE_ERROR: {
       GError* err = nullptr;
       gchar* debug = nullptr;
       gst_message_parse_error(msg, &err, &debug);
-      FlValue* event = make_event("error");
-      fl_value_set_string_take(event, "message",
-                                fl_value_new_string(err->message));
-      fl_value_set_string_take(event, "code",
-                                fl_value_new_string("GST_ERROR"));
-      send_event(inst, event);
+      g_free(inst->error_message);
+      inst->error_message = g_strdup(err->message);
+      send_error(inst);
       g_error_free(err);
       g_free(debug);
+      g_atomic_int_set(&inst->has_failed, TRUE);
+
+      // No ASYNC_DONE follows an error; drop the queue so later seeks are
+      // not held back forever.
+      inst->seek_in_flight = FALSE;
+      inst->pending_seek_ms = -1;
       break;
     }
     case GST_MESSAGE_EOS: {
-      FlValue* completed = make_event("completed");
-      send_event(inst, completed);
-
-      FlValue* state_event = make_event("playbackStateChanged");
-      fl_value_set_string_take(state_event, "state",
-                                fl_value_new_string("completed"));
-      send_event(inst, state_event);
+      if (is_listened(inst)) send_event(inst, make_event("completed"));
+      send_clock_anchor(inst, 0);
+      send_playback_state(inst, "completed");
 
       if (inst->is_looping) {
-        gst_element_seek_simple(inst->pipeline, GST_FORMAT_TIME,
-                                 static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT),
-                                 0);
+        // Reverse playback ends at the start and loops from the end.
+        gint64 restart_ns = inst->speed < 0 ? inst->duration_ms * GST_MSECOND : 0;
+        seek_at_speed(inst, restart_ns,
+                      static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT));
         gst_element_set_state(inst->pipeline, GST_STATE_PLAYING);
       }
       break;
@@ -236,39 +1218,13 @@ static gboolean on_bus_message(GstBus* bus, GstMessage* msg, gpointer user_data)
           inst->duration_ms = duration_ns / GST_MSECOND;
         }
 
-        // Query video dimensions from appsink pad
-        int width = 0, height = 0;
-        GstPad* pad = gst_element_get_static_pad(inst->video_sink, "sink");
-        if (pad != nullptr) {
-          GstCaps* caps = gst_pad_get_current_caps(pad);
-          if (caps != nullptr) {
-            GstVideoInfo vinfo;
-            if (gst_video_info_from_caps(&vinfo, caps)) {
-              width = GST_VIDEO_INFO_WIDTH(&vinfo);
-              height = GST_VIDEO_INFO_HEIGHT(&vinfo);
-            }
-            gst_caps_unref(caps);
-          }
-          gst_object_unref(pad);
-        }
-
-        FlValue* event = make_event("initialized");
-        fl_value_set_string_take(event, "duration",
-                                  fl_value_new_int(inst->duration_ms));
-        fl_value_set_string_take(event, "width",
-                                  fl_value_new_float(static_cast<double>(width)));
-        fl_value_set_string_take(event, "height",
-                                  fl_value_new_float(static_cast<double>(height)));
-        fl_value_set_string_take(event, "textureId",
-                                  fl_value_new_int(inst->texture_id));
-        send_event(inst, event);
-
-        FlValue* ready = make_event("playbackStateChanged");
-        fl_value_set_string_take(ready, "state",
-                                  fl_value_new_string("ready"));
-        send_event(inst, ready);
+        send_initialized(inst);
+        notify_prerolled(inst);
       }
 
+      set_playing(inst,
+                  inst->is_initialized && new_state == GST_STATE_PLAYING);
+
       // Map GStreamer state to our playback states
       if (inst->is_initialized) {
         const char* state_str = nullptr;
@@ -277,30 +1233,31 @@ static gboolean on_bus_message(GstBus* bus, GstMessage* msg, gpointer user_data)
         else if (new_state == GST_STATE_PAUSED && old_state == GST_STATE_PLAYING)
           state_str = "paused";
 
-        if (state_str != nullptr) {
-          FlValue* event = make_event("playbackStateChanged");
-          fl_value_set_string_take(event, "state",
-                                    fl_value_new_string(state_str));
-          send_event(inst, event);
-
-          if (inst->notification_enabled && inst->mpris) {
-            const gchar* mpris_status =
-                (strcmp(state_str, "playing") == 0) ? "Playing" : "Paused";
-            mpris_controller_set_playback_status(inst->mpris, mpris_status);
-          }
-        }
+        if (state_str != nullptr) send_playback_state(inst, state_str);
       }
       break;
     }
+    case GST_MESSAGE_STREAM_START: {
+      if (GST_MESSAGE_SRC(msg) != GST_OBJECT(inst->pipeline)) break;
+      adopt_started_track(inst);
+      break;
+    }
+    case GST_MESSAGE_ASYNC_DONE: {
+      // The pipeline prerolled: the initial preroll, a flushing seek or a
+      // rate change. Any of them frees the seek slot.
+      if (GST_MESSAGE_SRC(msg) != GST_OBJECT(inst->pipeline)) break;
+      issue_pending_seek(inst);
+      if (inst->is_initialized) send_clock_anchor(inst, running_rate(inst));
+      break;
+    }
     case GST_MESSAGE_BUFFERING: {
       gint percent = 0;
       gst_message_parse_buffering(msg, &percent);
-      if (percent < 100) {
-        FlValue* event = make_event("playbackStateChanged");
-        fl_value_set_string_take(event, "state",
-                                  fl_value_new_string("buffering"));
-        send_event(inst, event);
+      // Downloads continue while paused.
+      if (!inst->is_playing && inst->is_initialized) {
+        send_state_update(inst);
       }
+      if (percent < 100) send_playback_state(inst, "buffering");
       break;
     }
     default:
@@ -311,73 +1268,90 @@ static gboolean on_bus_message(GstBus* bus, GstMessage* msg, gpointer user_data)
 }
 
 // =============================================================================
-// Position polling timer (~200ms)
+// Video sink caps
 // =============================================================================
 
-static gboolean position_timer_cb(gpointer user_data) {
-  auto* inst = static_cast<PlayerInstance*>(user_data);
-  if (inst->is_disposed) return G_SOURCE_REMOVE;
-
-  gint64 pos_ns = 0;
-  if (gst_element_query_position(inst->pipeline, GST_FORMAT_TIME, &pos_ns)) {
-    gint64 pos_ms = pos_ns / GST_MSECOND;
-
-    FlValue* event = make_event("positionChanged");
-    fl_value_set_string_take(event, "position", fl_value_new_int(pos_ms));
-    send_event(inst, event);
-
-    // Update MPRIS position (microseconds)
-    if (inst->notification_enabled && inst->mpris) {
-      mpris_controller_set_position(inst->mpris, pos_ns / 1000);
-    }
+// Appsink caps for the current render size and conversion mode.
+static GstCaps* make_video_sink_caps(PlayerInstance* inst) {
+  GstCaps* caps =
+      inst->native_conversion
+          ? gst_caps_from_string(
+                "video/x-raw, format=(string){ I420, NV12, P010_10LE, RGBA }")
+          : gst_caps_new_simple("video/x-raw", "format", G_TYPE_STRING,
+                                "RGBA", nullptr);
+  if (inst->render_width > 0 && inst->render_height > 0) {
+    gst_caps_set_simple(caps,
+                        "width", GST_TYPE_INT_RANGE, 1, inst->render_width,
+                        "height", GST_TYPE_INT_RANGE, 1, inst->render_height,
+                        "pixel-aspect-ratio", GST_TYPE_FRACTION, 1, 1,
+                        nullptr);
   }
+  return caps;
+}
 
-  // Also check buffered level
-  GstQuery* query = gst_query_new_buffering(GST_FORMAT_TIME);
-  if (gst_element_query(inst->pipeline, query)) {
-    gint64 start = 0, stop = 0;
-    gst_query_parse_buffering_range(query, nullptr, &start, &stop, nullptr);
-    if (stop > 0) {
-      FlValue* event = make_event("bufferingUpdate");
-      fl_value_set_string_take(event, "buffered",
-                                fl_value_new_int(stop / GST_MSECOND));
-      send_event(inst, event);
-    }
-  }
-  gst_query_unref(query);
+// Installs caps for the current settings and asks upstream to renegotiate.
+static void update_video_sink_caps(PlayerInstance* inst) {
+  GstCaps* caps = make_video_sink_caps(inst);
+  g_object_set(inst->video_sink, "caps", caps, nullptr);
+  gst_caps_unref(caps);
 
-  return G_SOURCE_CONTINUE;
+  GstPad* pad = gst_element_get_static_pad(inst->video_sink, "sink");
+  if (pad != nullptr) {
+    gst_pad_push_event(pad, gst_event_new_reconfigure());
+    gst_object_unref(pad);
+  }
 }
 
 // =============================================================================
 // Public API
 // =============================================================================
 
-PlayerInstance* player_instance_new(FlTextureRegistrar* texture_registrar,
-                                     FlEventChannel* event_channel,
-                                     const gchar* uri) {
+// Allocates the instance and registers its texture. Main thread.
+static PlayerInstance* instance_alloc(FlTextureRegistrar* texture_registrar,
+                                      FlEventChannel* event_channel,
+                                      const gchar* uri,
+                                      guint conversion_threads) {
   auto* inst = g_new0(PlayerInstance, 1);
   inst->texture_registrar = FL_TEXTURE_REGISTRAR(g_object_ref(texture_registrar));
   inst->event_channel = event_channel ? FL_EVENT_CHANNEL(g_object_ref(event_channel)) : nullptr;
   inst->speed = 1.0;
+  inst->segment_rate = 1.0;
   inst->is_looping = FALSE;
   inst->is_initialized = FALSE;
-  inst->is_disposed = FALSE;
+  g_atomic_int_set(&inst->is_disposed, FALSE);
+  inst->sent_buffered_ms = -1;
+  inst->preroll_pts = GST_CLOCK_TIME_NONE;
+  inst->uri = g_strdup(uri);
+  inst->pending_seek_ms = -1;
+  inst->conversion_threads = static_cast<gint>(conversion_threads);
+  g_mutex_init(&inst->queue_lock);
+  g_mutex_init(&inst->outbox_lock);
+  inst->outbox = outbox_new();
 
   // Create texture
   inst->texture = AV_PIP_TEXTURE(g_object_new(av_pip_texture_get_type(), nullptr));
   fl_texture_registrar_register_texture(texture_registrar, FL_TEXTURE(inst->texture));
   inst->texture_id = fl_texture_get_id(FL_TEXTURE(inst->texture));
+  return inst;
+}
 
+// Builds the pipeline and starts prerolling. Touches no Flutter state, so
+// it may run on a worker thread.
+static void build_pipeline(PlayerInstance* inst) {
   // Create GStreamer pipeline
   inst->pipeline = gst_element_factory_make("playbin", nullptr);
 
-  // Build video sink: videoconvert ! video/x-raw,format=RGBA ! appsink
-  GstElement* convert = gst_element_factory_make("videoconvert", nullptr);
+  // Build video sink:
+  // videoscale ! videoconvert ! video/x-raw,format=RGBA ! appsink
+  // Scaling comes first so conversion runs at the render size. videoscale
+  // passes buffers through untouched until a render size is set.
+  inst->video_scale = gst_element_factory_make("videoscale", nullptr);
+  inst->video_convert = gst_element_factory_make("videoconvert", nullptr);
   inst->video_sink = gst_element_factory_make("appsink", nullptr);
+  player_instance_set_conversion_threads(
+      inst, static_cast<guint>(inst->conversion_threads));
 
-  GstCaps* caps = gst_caps_new_simple("video/x-raw", "format", G_TYPE_STRING,
-                                        "RGBA", nullptr);
+  GstCaps* caps = make_video_sink_caps(inst);
   g_object_set(inst->video_sink,
                "caps", caps,
                "emit-signals", TRUE,
@@ -388,32 +1362,95 @@ PlayerInstance* player_instance_new(FlTextureRegistrar* texture_registrar,
   gst_caps_unref(caps);
 
   GstAppSinkCallbacks callbacks = {};
+  callbacks.new_preroll = on_new_preroll;
   callbacks.new_sample = on_new_sample;
+  callbacks.eos = on_eos;
   gst_app_sink_set_callbacks(GST_APP_SINK(inst->video_sink), &callbacks, inst,
                               nullptr);
 
   GstElement* bin = gst_bin_new("video_sink_bin");
-  gst_bin_add_many(GST_BIN(bin), convert, inst->video_sink, nullptr);
-  gst_element_link(convert, inst->video_sink);
+  gst_bin_add_many(GST_BIN(bin), inst->video_scale, inst->video_convert,
+                   inst->video_sink, nullptr);
+  gst_element_link_many(inst->video_scale, inst->video_convert,
+                        inst->video_sink, nullptr);
 
-  GstPad* pad = gst_element_get_static_pad(convert, "sink");
+  GstPad* pad = gst_element_get_static_pad(inst->video_scale, "sink");
   GstPad* ghost = gst_ghost_pad_new("sink", pad);
   gst_element_add_pad(bin, ghost);
   gst_object_unref(pad);
 
-  g_object_set(inst->pipeline, "uri", uri, "video-sink", bin, nullptr);
+  g_object_set(inst->pipeline, "uri", inst->uri, "video-sink", bin, nullptr);
+  g_signal_connect(inst->pipeline, "about-to-finish",
+                   G_CALLBACK(on_about_to_finish), inst);
+
+  GstPad* scale_pad = gst_element_get_static_pad(inst->video_scale, "sink");
+  gst_pad_add_probe(scale_pad, GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
+                    on_video_stream_event, inst, nullptr);
+  gst_object_unref(scale_pad);
+
+  GstElement* audio_filter = make_time_stretch_filter(inst);
+  if (audio_filter != nullptr) {
+    g_object_set(inst->pipeline, "audio-filter", audio_filter, nullptr);
+  }
+
+  // Preroll to PAUSED to get video info; on_new_preroll shows the first frame.
+  // Seeks wait for it like for a flushing seek.
+  inst->seek_in_flight = gst_element_set_state(inst->pipeline,
+                                               GST_STATE_PAUSED) ==
+                         GST_STATE_CHANGE_ASYNC;
+}
+
+// Main thread, once the pipeline is built. Bus messages are handled on the
+// control thread.
+static void start_watching(PlayerInstance* inst) {
+  GMainContext* context = control_thread_get_context();
 
-  // Watch bus messages on the default main context
   GstBus* bus = gst_element_get_bus(inst->pipeline);
-  gst_bus_add_watch(bus, on_bus_message, inst);
+  inst->bus_watch = gst_bus_create_watch(bus);
   gst_object_unref(bus);
+  g_source_set_callback(inst->bus_watch,
+                        reinterpret_cast<GSourceFunc>(on_bus_message), inst,
+                        nullptr);
+  g_source_attach(inst->bus_watch, context);
+}
+
+PlayerInstance* player_instance_new(FlTextureRegistrar* texture_registrar,
+                                     FlEventChannel* event_channel,
+                                     const gchar* uri,
+                                     guint conversion_threads) {
+  PlayerInstance* inst = instance_alloc(texture_registrar, event_channel, uri,
+                                        conversion_threads);
+  build_pipeline(inst);
+  start_watching(inst);
+  return inst;
+}
 
-  // Preroll to PAUSED to get video info
-  gst_element_set_state(inst->pipeline, GST_STATE_PAUSED);
+static void build_pipeline_in_thread(GTask* task,
+                                     gpointer source_object,
+                                     gpointer task_data,
+                                     GCancellable* cancellable) {
+  auto* inst = static_cast<PlayerInstance*>(task_data);
+  build_pipeline(inst);
+  g_task_return_pointer(task, inst, nullptr);
+}
 
-  // Start position polling
-  inst->position_timer_id = g_timeout_add(200, position_timer_cb, inst);
+void player_instance_new_async(FlTextureRegistrar* texture_registrar,
+                               const gchar* uri,
+                               guint conversion_threads,
+                               GAsyncReadyCallback callback,
+                               gpointer user_data) {
+  PlayerInstance* inst =
+      instance_alloc(texture_registrar, nullptr, uri, conversion_threads);
+  GTask* task = g_task_new(nullptr, nullptr, callback, user_data);
+  g_task_set_task_data(task, inst, nullptr);
+  g_task_run_in_thread(task, build_pipeline_in_thread);
+  g_object_unref(task);
+}
 
+PlayerInstance* player_instance_new_finish(GAsyncResult* result) {
+  auto* inst = static_cast<PlayerInstance*>(
+      g_task_propagate_pointer(G_TASK(result), nullptr));
+  start_watching(inst);
   return inst;
 }
 
@@ -421,6 +1458,30 @@ int64_t player_instance_get_texture_id(PlayerInstance* instance) {
   return instance->texture_id;
 }
 
+void player_instance_on_listen(PlayerInstance* instance) {
+  control_thread_post([instance] {
+    g_atomic_int_set(&instance->listening, TRUE);
+    send_snapshot(instance);
+  });
+}
+
+void player_instance_on_cancel(PlayerInstance* instance) {
+  control_thread_post(
+      [instance] { g_atomic_int_set(&instance->listening, FALSE); });
+}
+
+gboolean player_instance_has_failed(PlayerInstance* instance) {
+  return g_atomic_int_get(&instance->has_failed);
+}
+
+size_t player_instance_estimate_memory(PlayerInstance* instance) {
+  if (!g_atomic_int_get(&instance->video_size_valid)) return 0;
+  // Three RGBA texture slots at native size; render-size scaling only makes
+  // them smaller.
+  return static_cast<size_t>(g_atomic_int_get(&instance->video_width)) *
+         g_atomic_int_get(&instance->video_height) * 4 * 3;
+}
+
 void player_instance_set_event_channel(PlayerInstance* instance,
                                         FlEventChannel* event_channel) {
   if (instance->event_channel != nullptr) {
@@ -430,47 +1491,105 @@ void player_instance_set_event_channel(PlayerInstance* instance,
       event_channel ? FL_EVENT_CHANNEL(g_object_ref(event_channel)) : nullptr;
 }
 
-void player_instance_play(PlayerInstance* instance) {
-  gst_element_set_state(instance->pipeline, GST_STATE_PLAYING);
-  if (instance->speed != 1.0) {
-    gint64 pos_ns = 0;
-    gst_element_query_position(instance->pipeline, GST_FORMAT_TIME, &pos_ns);
-    gst_element_seek(instance->pipeline, instance->speed, GST_FORMAT_TIME,
-                      static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE),
-                      GST_SEEK_TYPE_SET, pos_ns,
-                      GST_SEEK_TYPE_NONE, -1);
+void player_instance_set_event_api(PlayerInstance* instance,
+                                   AvPlayerAvPlayerEventApi* event_api) {
+  g_clear_object(&instance->event_api);
+  instance->event_api = event_api ? AV_PLAYER_AV_PLAYER_EVENT_API(
+                                        g_object_ref(event_api))
+                                  : nullptr;
+}
+
+// =============================================================================
+// Playback rate
+// =============================================================================
+
+// Changes the rate without a flush (GStreamer 1.18+). Refused when the
+// direction or trick mode changes.
+static gboolean apply_rate_instantly(PlayerInstance* inst) {
+#if GST_CHECK_VERSION(1, 18, 0)
+  GstSeekFlags trick_flags = trick_flags_for_rate(inst->speed);
+  if ((inst->speed < 0) != (inst->segment_rate < 0) ||
+      trick_flags != trick_flags_for_rate(inst->segment_rate)) {
+    return FALSE;
+  }
+  gboolean ok = gst_element_seek(
+      inst->pipeline, inst->speed, GST_FORMAT_TIME,
+      static_cast<GstSeekFlags>(GST_SEEK_FLAG_INSTANT_RATE_CHANGE | trick_flags),
+      GST_SEEK_TYPE_NONE, -1,
+      GST_SEEK_TYPE_NONE, -1);
+  if (ok) {
+    inst->segment_rate = inst->speed;
+    if (inst->is_playing) send_clock_anchor(inst, inst->speed);
+  }
+  return ok;
+#else
+  return FALSE;
+#endif
+}
+
+// Fallback: flushing seek to the current position at the new rate. Also the
+// only way into or out of trick mode and reverse playback.
+static void apply_rate_with_flush(PlayerInstance* inst) {
+  gint64 pos_ns = 0;
+  gst_element_query_position(inst->pipeline, GST_FORMAT_TIME, &pos_ns);
+  seek_at_speed(inst, pos_ns,
+                static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE));
+}
+
+// Applies a pending rate, instantly when possible. The flushing fallback is
+// only taken when |may_flush|; otherwise the rate stays pending for play().
+static void apply_pending_rate(PlayerInstance* inst, gboolean may_flush) {
+  if (!inst->rate_pending) return;
+  if (!apply_rate_instantly(inst)) {
+    if (!may_flush) return;
+    apply_rate_with_flush(inst);
   }
+  inst->rate_pending = FALSE;
+}
+
+void player_instance_play(PlayerInstance* instance) {
+  control_thread_post([instance] {
+    gst_element_set_state(instance->pipeline, GST_STATE_PLAYING);
+    apply_pending_rate(instance, TRUE);
+  });
 }
 
 void player_instance_pause(PlayerInstance* instance) {
-  gst_element_set_state(instance->pipeline, GST_STATE_PAUSED);
+  control_thread_post([instance] {
+    gst_element_set_state(instance->pipeline, GST_STATE_PAUSED);
+  });
 }
 
-void player_instance_seek_to(PlayerInstance* instance, int64_t position_ms) {
-  gint64 pos_ns = position_ms * GST_MSECOND;
-  gst_element_seek(instance->pipeline, instance->speed, GST_FORMAT_TIME,
-                    static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE),
-                    GST_SEEK_TYPE_SET, pos_ns,
-                    GST_SEEK_TYPE_NONE, -1);
+void player_instance_seek_to(PlayerInstance* instance,
+                             int64_t position_ms,
+                             AvPlayerSeekMode mode) {
+  control_thread_post([instance, position_ms, mode] {
+    if (instance->seek_in_flight) {
+      instance->pending_seek_ms = position_ms;
+      instance->pending_seek_mode = mode;
+      return;
+    }
+    issue_seek(instance, position_ms, mode);
+  });
 }
 
 void player_instance_set_speed(PlayerInstance* instance, double speed) {
-  instance->speed = speed;
-  // Apply immediately if playing
-  GstState state;
-  gst_element_get_state(instance->pipeline, &state, nullptr, 0);
-  if (state == GST_STATE_PLAYING) {
-    gint64 pos_ns = 0;
-    gst_element_query_position(instance->pipeline, GST_FORMAT_TIME, &pos_ns);
-    gst_element_seek(instance->pipeline, speed, GST_FORMAT_TIME,
-                      static_cast<GstSeekFlags>(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE),
-                      GST_SEEK_TYPE_SET, pos_ns,
-                      GST_SEEK_TYPE_NONE, -1);
-  }
+  // Rate 0 is not a valid segment rate; pause() stops playback.
+  if (speed == 0.0) return;
+  control_thread_post([instance, speed] {
+    if (speed == instance->speed && !instance->rate_pending) return;
+    instance->speed = speed;
+    instance->rate_pending = TRUE;
+    // Paused pipelines take an instant change too; flushing one would only
+    // re-preroll the same frame, so that waits for play().
+    GstState state;
+    gst_element_get_state(instance->pipeline, &state, nullptr, 0);
+    apply_pending_rate(instance, state == GST_STATE_PLAYING);
+  });
 }
 
 void player_instance_set_looping(PlayerInstance* instance, gboolean looping) {
-  instance->is_looping = looping;
+  control_thread_post([instance, looping] { instance->is_looping = looping; });
 }
 
 void player_instance_set_volume(PlayerInstance* instance, double volume) {
@@ -479,6 +1598,145 @@ void player_instance_set_volume(PlayerInstance* instance, double volume) {
   g_object_set(instance->pipeline, "volume", volume, nullptr);
 }
 
+void player_instance_set_render_size(PlayerInstance* instance,
+                                      int32_t width,
+                                      int32_t height) {
+  if (width <= 0 || height <= 0) {
+    width = 0;
+    height = 0;
+  }
+  if (width == instance->render_width && height == instance->render_height) {
+    return;
+  }
+  instance->render_width = width;
+  instance->render_height = height;
+  update_video_sink_caps(instance);
+}
+
+void player_instance_set_native_conversion(PlayerInstance* instance,
+                                            gboolean enabled) {
+  enabled = enabled ? TRUE : FALSE;
+  if (enabled == instance->native_conversion) return;
+  instance->native_conversion = enabled;
+  if (enabled) {
+    g_debug("av_player: native YUV conversion uses the %s path",
+            yuv_converter_backend_name());
+  }
+  update_video_sink_caps(instance);
+}
+
+void player_instance_set_conversion_threads(PlayerInstance* instance,
+                                             guint n_threads) {
+  n_threads = CLAMP(n_threads, 1u, static_cast<guint>(G_MAXINT));
+  g_atomic_int_set(&instance->conversion_threads,
+                   static_cast<gint>(n_threads));
+  // n-threads = 0 would mean "all cores" to the elements, so never pass it.
+  g_object_set(instance->video_convert, "n-threads", n_threads, nullptr);
+  g_object_set(instance->video_scale, "n-threads", n_threads, nullptr);
+}
+
+void player_instance_get_frame_counters(PlayerInstance* instance,
+                                        guint* decoded,
+                                        guint* presented,
+                                        guint* dropped) {
+  AvPipTexture* tex = instance->texture;
+  if (decoded != nullptr) {
+    *decoded = static_cast<guint>(g_atomic_int_get(&tex->frames_decoded));
+  }
+  if (presented != nullptr) {
+    *presented = static_cast<guint>(g_atomic_int_get(&tex->frames_presented));
+  }
+  if (dropped != nullptr) {
+    *dropped = static_cast<guint>(g_atomic_int_get(&tex->frames_dropped));
+  }
+}
+
+GArray* player_instance_get_keyframes(PlayerInstance* instance) {
+  g_mutex_lock(&instance->queue_lock);
+  g_autofree gchar* uri = g_strdup(instance->uri);
+  g_mutex_unlock(&instance->queue_lock);
+
+  // The index belongs to a previous source.
+  if (g_strcmp0(instance->keyframe_uri, uri) != 0) {
+    keyframe_index_free(instance->keyframe_index);
+    instance->keyframe_index = keyframe_index_new(uri);
+    g_free(instance->keyframe_uri);
+    instance->keyframe_uri = static_cast<gchar*>(g_steal_pointer(&uri));
+  }
+  if (instance->keyframe_index == nullptr) {
+    return g_array_new(FALSE, FALSE, sizeof(gint64));
+  }
+  return keyframe_index_get_positions(instance->keyframe_index);
+}
+
+void player_instance_queue_next(PlayerInstance* instance, const gchar* uri) {
+  g_mutex_lock(&instance->queue_lock);
+  g_free(instance->next_uri);
+  instance->next_uri = g_strdup(uri);
+  g_mutex_unlock(&instance->queue_lock);
+}
+
+void player_instance_set_source(PlayerInstance* instance, const gchar* uri) {
+  control_thread_post([instance, new_uri = std::string(uri)] {
+    // READY stops the streaming threads and drops the old source's decoders
+    // and segment, but keeps the sinks, their pads and the texture.
+    gst_element_set_state(instance->pipeline, GST_STATE_READY);
+    // Drop the old source's queued state changes, which would send
+    // initialized early.
+    GstBus* bus = gst_element_get_bus(instance->pipeline);
+    gst_bus_set_flushing(bus, TRUE);
+    gst_bus_set_flushing(bus, FALSE);
+    gst_object_unref(bus);
+
+    // The keyframe index notices the new URI on its next use.
+    g_mutex_lock(&instance->queue_lock);
+    g_clear_pointer(&instance->next_uri, g_free);
+    g_clear_pointer(&instance->started_uri, g_free);
+    g_free(instance->uri);
+    instance->uri = g_strdup(new_uri.c_str());
+    g_mutex_unlock(&instance->queue_lock);
+
+    // Back to the state player_instance_new leaves, apart from settings.
+    instance->is_initialized = FALSE;
+    instance->playback_state = nullptr;
+    g_atomic_int_set(&instance->has_failed, FALSE);
+    g_clear_pointer(&instance->error_message, g_free);
+    instance->duration_ms = 0;
+    instance->pending_seek_ms = -1;
+    instance->segment_rate = 1.0;
+    instance->rate_pending = instance->speed != 1.0;
+    instance->preroll_pts = GST_CLOCK_TIME_NONE;
+    g_atomic_int_set(&instance->video_size_valid, FALSE);
+    // The flushed state change would have told the scheduler.
+    set_playing(instance, FALSE);
+
+    g_object_set(instance->pipeline, "uri", new_uri.c_str(), nullptr);
+    // The first PAUSED sends initialized again, and the preroll frame
+    // replaces the old source's picture.
+    instance->seek_in_flight = gst_element_set_state(instance->pipeline,
+                                                     GST_STATE_PAUSED) ==
+                               GST_STATE_CHANGE_ASYNC;
+  });
+}
+
+void player_instance_get_render_stats(PlayerInstance* instance,
+                                      PlayerRenderStats* stats) {
+  player_instance_get_frame_counters(instance, &stats->frames_decoded,
+                                     &stats->frames_presented,
+                                     &stats->frames_dropped);
+  static const double kPercentiles[3] = {50.0, 95.0, 99.0};
+  for (int i = 0; i < 3; i++) {
+    stats->conversion_us[i] = latency_histogram_percentile(
+        &instance->conversion_latency, kPercentiles[i]);
+    stats->copy_us[i] =
+        latency_histogram_percentile(&instance->copy_latency, kPercentiles[i]);
+    stats->lateness_us[i] =
+        latency_histogram_percentile(&instance->lateness, kPercentiles[i]);
+    stats->audio_filter_us[i] = latency_histogram_percentile(
+        &instance->audio_filter_cpu, kPercentiles[i]);
+  }
+}
+
 void player_instance_set_media_metadata(PlayerInstance* instance,
                                          const gchar* title,
                                          const gchar* artist,
@@ -500,31 +1758,75 @@ void player_instance_set_media_metadata(PlayerInstance* instance,
 
 void player_instance_set_notification_enabled(PlayerInstance* instance,
                                                gboolean enabled) {
-  instance->notification_enabled = enabled;
-
   if (enabled && instance->mpris == nullptr) {
-    instance->mpris = mpris_controller_new(mpris_command_cb, instance);
+    MprisController* mpris = mpris_controller_new(mpris_command_cb, instance);
     if (instance->meta_title || instance->meta_artist) {
-      mpris_controller_set_metadata(instance->mpris,
+      mpris_controller_set_metadata(mpris,
                                      instance->meta_title,
                                      instance->meta_artist,
                                      instance->meta_album,
                                      instance->meta_art_url);
     }
+    control_thread_run_sync([instance, mpris] {
+      instance->mpris = mpris;
+      update_mpris_status(instance);
+      update_mpris_position(instance);
+    });
   } else if (!enabled && instance->mpris != nullptr) {
-    mpris_controller_free(instance->mpris);
-    instance->mpris = nullptr;
+    MprisController* mpris = instance->mpris;
+    control_thread_run_sync([instance] { instance->mpris = nullptr; });
+    mpris_controller_free(mpris);
   }
 }
 
-void player_instance_dispose(PlayerInstance* instance) {
-  if (instance == nullptr || instance->is_disposed) return;
-  instance->is_disposed = TRUE;
+void player_instance_set_playing_callback(PlayerInstance* instance,
+                                          PlayerPlayingCallback callback,
+                                          gpointer user_data) {
+  control_thread_post([instance, callback, user_data] {
+    instance->playing_cb = callback;
+    instance->playing_cb_data = user_data;
+    if (instance->is_playing && callback != nullptr) {
+      callback(instance, TRUE, user_data);
+    }
+  });
+}
+
+void player_instance_set_prerolled_callback(PlayerInstance* instance,
+                                            PlayerPrerolledCallback callback,
+                                            gpointer user_data) {
+  instance->prerolled_cb = callback;
+  instance->prerolled_cb_data = user_data;
+}
+
+void player_instance_tick(PlayerInstance* instance) {
+  if (g_atomic_int_get(&instance->is_disposed)) return;
+  check_clock(instance);
+  send_state_update(instance);
+}
 
-  if (instance->position_timer_id > 0) {
-    g_source_remove(instance->position_timer_id);
-    instance->position_timer_id = 0;
+void player_instance_dispose(PlayerInstance* instance) {
+  if (instance == nullptr || g_atomic_int_get(&instance->is_disposed)) return;
+  g_mutex_lock(&instance->outbox_lock);
+  g_atomic_int_set(&instance->is_disposed, TRUE);
+  if (instance->outbox_idle_id != 0) {
+    g_source_remove(instance->outbox_idle_id);
+    instance->outbox_idle_id = 0;
   }
+  g_mutex_unlock(&instance->outbox_lock);
+
+  // Calls posted earlier run first; once this returns the control thread no
+  // longer touches the instance.
+  control_thread_run_sync([instance] {
+    if (instance->bus_watch != nullptr) {
+      g_source_destroy(instance->bus_watch);
+      g_source_unref(instance->bus_watch);
+      instance->bus_watch = nullptr;
+    }
+    if (instance->is_playing && instance->playing_cb != nullptr) {
+      instance->playing_cb(instance, FALSE, instance->playing_cb_data);
+    }
+    instance->playing_cb = nullptr;
+  });
 
   if (instance->mpris != nullptr) {
     mpris_controller_free(instance->mpris);
@@ -533,16 +1835,20 @@ void player_instance_dispose(PlayerInstance* instance) {
 
   if (instance->pipeline != nullptr) {
     gst_element_set_state(instance->pipeline, GST_STATE_NULL);
-    // Remove bus watch
-    GstBus* bus = gst_element_get_bus(instance->pipeline);
-    if (bus != nullptr) {
-      gst_bus_remove_watch(bus);
-      gst_object_unref(bus);
-    }
     gst_object_unref(instance->pipeline);
     instance->pipeline = nullptr;
   }
 
+  if (instance->video_caps != nullptr) {
+    gst_caps_unref(instance->video_caps);
+    instance->video_caps = nullptr;
+  }
+  g_clear_pointer(&instance->skipped_sample, gst_sample_unref);
+
+  keyframe_index_free(instance->keyframe_index);
+  instance->keyframe_index = nullptr;
+  g_free(instance->keyframe_uri);
+
   if (instance->texture != nullptr) {
     fl_texture_registrar_unregister_texture(instance->texture_registrar,
                                              FL_TEXTURE(instance->texture));
@@ -553,11 +1859,19 @@ void player_instance_dispose(PlayerInstance* instance) {
   g_object_unref(instance->texture_registrar);
   if (instance->event_channel != nullptr)
     g_object_unref(instance->event_channel);
+  g_clear_object(&instance->event_api);
 
   g_free(instance->meta_title);
   g_free(instance->meta_artist);
   g_free(instance->meta_album);
   g_free(instance->meta_art_url);
+  g_free(instance->error_message);
+  g_free(instance->uri);
+  g_free(instance->next_uri);
+  g_free(instance->started_uri);
+  g_mutex_clear(&instance->queue_lock);
+  g_array_unref(instance->outbox);
+  g_mutex_clear(&instance->outbox_lock);
 
   g_free(instance);
 }
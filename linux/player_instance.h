@@ -5,17 +5,40 @@
 #include <gst/gst.h>
 #include <gst/app/gstappsink.h>
 
+#include "messages.g.h"
 #include "mpris_controller.h"
 
 // Opaque player instance managed by the main plugin.
+//
+// All functions are called on the main thread unless noted. Bus messages,
+// ticks and playback control (play, pause, seeks, speed, looping and
+// source changes) run on the process-wide control thread, so those calls
+// return before they take effect; their events reach the event channel
+// back on the main thread.
 typedef struct _PlayerInstance PlayerInstance;
 
 // Create a new GStreamer-based player for the given URI.
 // texture_registrar: used to register the FlPixelBufferTexture
 // event_channel: may be nullptr initially (set later with setter)
+// conversion_threads: initial player_instance_set_conversion_threads value
 PlayerInstance* player_instance_new(FlTextureRegistrar* texture_registrar,
                                      FlEventChannel* event_channel,
-                                     const gchar* uri);
+                                     const gchar* uri,
+                                     guint conversion_threads);
+
+// Like player_instance_new, but element lookups and pipeline construction
+// run on a worker thread so a cold GStreamer registry does not stall the
+// UI. The texture is registered before this returns. |callback| runs on the
+// calling thread's main context and must call player_instance_new_finish.
+void player_instance_new_async(FlTextureRegistrar* texture_registrar,
+                               const gchar* uri,
+                               guint conversion_threads,
+                               GAsyncReadyCallback callback,
+                               gpointer user_data);
+
+// Completes player_instance_new_async and returns the player, prerolling
+// and with its event channel unset.
+PlayerInstance* player_instance_new_finish(GAsyncResult* result);
 
 // Get the Flutter texture ID (set after registration).
 int64_t player_instance_get_texture_id(PlayerInstance* instance);
@@ -24,14 +47,120 @@ int64_t player_instance_get_texture_id(PlayerInstance* instance);
 void player_instance_set_event_channel(PlayerInstance* instance,
                                         FlEventChannel* event_channel);
 
+// Sends clockAnchor and stateUpdate as typed AvPlayerEventApi messages
+// instead of event channel maps. nullptr puts them back on the channel.
+void player_instance_set_event_api(PlayerInstance* instance,
+                                   AvPlayerAvPlayerEventApi* event_api);
+
+// Call when Dart starts and stops listening on the event channel. No events
+// are built while nobody listens (a preloaded player, or one whose widget
+// went away), but MPRIS keeps following the playback state and position. A
+// new listener gets the latest state instead: the error of a failed
+// pipeline, or initialized, the playback state, a clock anchor and the
+// buffered end.
+void player_instance_on_listen(PlayerInstance* instance);
+void player_instance_on_cancel(PlayerInstance* instance);
+
+// Whether the pipeline posted an error. The error event is lost if nobody
+// was listening, so a preloaded player is checked before it is handed out.
+gboolean player_instance_has_failed(PlayerInstance* instance);
+
+// Rough bytes held by the player's frames, from the native video size; 0
+// until the size is known. Used to cap the preload pool.
+size_t player_instance_estimate_memory(PlayerInstance* instance);
+
 // Playback control
 void player_instance_play(PlayerInstance* instance);
 void player_instance_pause(PlayerInstance* instance);
-void player_instance_seek_to(PlayerInstance* instance, int64_t position_ms);
+
+// At most one seek is in flight. A seek requested before the pipeline
+// finished prerolling (ASYNC_DONE) from the initial PAUSED or the previous
+// flushing seek replaces any target still waiting and is issued when it does,
+// so a scrub gesture costs one flush per preroll rather than one per drag
+// update.
+void player_instance_seek_to(PlayerInstance* instance,
+                             int64_t position_ms,
+                             AvPlayerSeekMode mode);
+// Changes the rate without flushing where the pipeline supports instant rate
+// changes (GStreamer 1.18+); otherwise a playing pipeline falls back to a
+// flushing seek and a paused one applies the rate on the next play.
+// Negative speeds play in reverse. Above 4x in either direction only
+// keyframes are decoded and audio is muted (trick mode); entering or leaving
+// trick mode or changing direction always flushes. 0 is ignored. Audio keeps
+// its pitch when scaletempo is installed.
 void player_instance_set_speed(PlayerInstance* instance, double speed);
 void player_instance_set_looping(PlayerInstance* instance, gboolean looping);
 void player_instance_set_volume(PlayerInstance* instance, double volume);
 
+// Limit decoded frames to the on-screen size in physical pixels. Frames are
+// downscaled (never upscaled) with the display aspect ratio preserved;
+// width or height <= 0 restores native resolution.
+void player_instance_set_render_size(PlayerInstance* instance,
+                                      int32_t width,
+                                      int32_t height);
+
+// Convert I420, NV12 and P010 frames with the built-in SIMD converter
+// (yuv_converter.h) instead of videoconvert. Other formats still go through
+// videoconvert.
+void player_instance_set_native_conversion(PlayerInstance* instance,
+                                            gboolean enabled);
+
+// Number of threads (>= 1) for color conversion and scaling: the n-threads
+// of videoconvert / videoscale and the band count of the native converter.
+// The elements apply it when they next negotiate; the native converter on
+// the next frame. The plugin hands these out from a shared core budget.
+void player_instance_set_conversion_threads(PlayerInstance* instance,
+                                             guint n_threads);
+
+// Frame accounting since the player was created. decoded counts frames that
+// reached the appsink, presented those the engine picked up for display, and
+// dropped those skipped or replaced by a newer frame before it could. Many
+// drops point at a raster-bound app; presented falling behind without drops
+// at the decoder. Any argument may be nullptr.
+void player_instance_get_frame_counters(PlayerInstance* instance,
+                                        guint* decoded,
+                                        guint* presented,
+                                        guint* dropped);
+
+// Render path statistics since the player was created. Latencies are the
+// 50th, 95th and 99th percentiles in microseconds: conversion is the native
+// YUV to RGBA step, copy the RGBA attach or row copy, lateness how far the
+// pipeline clock is past a frame's PTS when it reaches the texture, and
+// audio_filter the CPU time the pitch-keeping scaletempo filter spends per
+// audio buffer (all zero without scaletempo).
+typedef struct {
+  guint frames_decoded;
+  guint frames_presented;
+  guint frames_dropped;
+  gint64 conversion_us[3];
+  gint64 copy_us[3];
+  gint64 lateness_us[3];
+  gint64 audio_filter_us[3];
+} PlayerRenderStats;
+
+// Keyframe positions in milliseconds (gint64, ascending) for snapping seeks
+// in the UI. The first call starts indexing the source in the background
+// (keyframe_index.h) and later calls return what has been found so far.
+// Returns an empty array for sources that are not indexed (non-file URIs).
+// Free with g_array_unref.
+GArray* player_instance_get_keyframes(PlayerInstance* instance);
+
+void player_instance_get_render_stats(PlayerInstance* instance,
+                                      PlayerRenderStats* stats);
+
+// Plays |uri| right after the current source, gaplessly, on the same
+// pipeline, texture and event channel. The switch happens from playbin's
+// about-to-finish and is reported with a "trackChanged" event. A later call
+// replaces the queued URI. A queued URI takes precedence over looping.
+void player_instance_queue_next(PlayerInstance* instance, const gchar* uri);
+
+// Replaces the source with |uri| without tearing the player down: the
+// pipeline drops to READY and prerolls the new URI, keeping the texture, its
+// buffers, the event channel and MPRIS. Sends "initialized" again once
+// prerolled and stays paused. Queued URIs and seeks are dropped; volume,
+// speed, looping and render settings carry over.
+void player_instance_set_source(PlayerInstance* instance, const gchar* uri);
+
 // Media metadata (delegates to MPRIS controller)
 void player_instance_set_media_metadata(PlayerInstance* instance,
                                          const gchar* title,
@@ -43,6 +172,35 @@ void player_instance_set_media_metadata(PlayerInstance* instance,
 void player_instance_set_notification_enabled(PlayerInstance* instance,
                                                gboolean enabled);
 
+// Called on the control thread when the initialized pipeline starts or
+// stops playing, and with FALSE on dispose if it was playing.
+typedef void (*PlayerPlayingCallback)(PlayerInstance* instance,
+                                      gboolean playing,
+                                      gpointer user_data);
+
+// Sets the callback the plugin's scheduler uses to know which players to
+// tick. Reports a player that is already playing right away.
+void player_instance_set_playing_callback(PlayerInstance* instance,
+                                          PlayerPlayingCallback callback,
+                                          gpointer user_data);
+
+// Called on the main thread after the pipeline first prerolls (again after
+// set_source), once player_instance_estimate_memory knows the frame size.
+// The callback may dispose the player.
+typedef void (*PlayerPrerolledCallback)(PlayerInstance* instance,
+                                        gpointer user_data);
+
+// Sets the callback the plugin uses to re-check the preload pool's byte cap.
+// nullptr clears it.
+void player_instance_set_prerolled_callback(PlayerInstance* instance,
+                                            PlayerPrerolledCallback callback,
+                                            gpointer user_data);
+
+// Periodic work of a playing player: re-anchors the clock when the position
+// stalls, resumes or drifts, and sends the buffered end when it changed.
+// Control thread, about every 200 ms.
+void player_instance_tick(PlayerInstance* instance);
+
 // Dispose and free all resources.
 void player_instance_dispose(PlayerInstance* instance);
 
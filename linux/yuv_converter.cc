@@ -0,0 +1,444 @@
+#include "yuv_converter.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define YUV_CONVERTER_X86 1
+#endif
+
+// =============================================================================
+// Coefficients
+// =============================================================================
+
+namespace {
+
+// Q16 fixed-point conversion constants for one matrix / range / bit depth.
+// Every path evaluates the same integer expressions, so SIMD and scalar
+// output is bit-identical.
+struct Coefficients {
+  int32_t y_offset;  // black level
+  int32_t c_offset;  // chroma zero point
+  int32_t y;         // luma gain
+  int32_t r_v;
+  int32_t g_u;
+  int32_t g_v;
+  int32_t b_u;
+};
+
+Coefficients make_coefficients(YuvMatrix matrix,
+                               gboolean full_range,
+                               int bit_depth) {
+  double kr, kb;
+  switch (matrix) {
+    case YUV_MATRIX_BT601:
+      kr = 0.299;
+      kb = 0.114;
+      break;
+    case YUV_MATRIX_BT2020:
+      kr = 0.2627;
+      kb = 0.0593;
+      break;
+    case YUV_MATRIX_BT709:
+    default:
+      kr = 0.2126;
+      kb = 0.0722;
+      break;
+  }
+  const double kg = 1.0 - kr - kb;
+  const int shift = bit_depth - 8;
+
+  double y_range, c_range;
+  Coefficients k;
+  if (full_range) {
+    k.y_offset = 0;
+    y_range = c_range = (1 << bit_depth) - 1;
+  } else {
+    k.y_offset = 16 << shift;
+    y_range = 219 << shift;
+    c_range = 224 << shift;
+  }
+  k.c_offset = 128 << shift;
+
+  const double y_scale = 255.0 / y_range * 65536.0;
+  const double c_scale = 255.0 / c_range * 65536.0;
+  k.y = static_cast<int32_t>(std::lround(y_scale));
+  k.r_v = static_cast<int32_t>(std::lround(2.0 * (1.0 - kr) * c_scale));
+  k.b_u = static_cast<int32_t>(std::lround(2.0 * (1.0 - kb) * c_scale));
+  k.g_u = static_cast<int32_t>(std::lround(2.0 * kb * (1.0 - kb) / kg * c_scale));
+  k.g_v = static_cast<int32_t>(std::lround(2.0 * kr * (1.0 - kr) / kg * c_scale));
+  return k;
+}
+
+// One output row. For I420 u and v are separate planes; for NV12 and P010 u
+// points at the interleaved UV row and v is unused.
+struct Row {
+  const uint8_t* y;
+  const uint8_t* u;
+  const uint8_t* v;
+  uint32_t* dst;
+  int width;
+};
+
+typedef void (*RowFunc)(const Row& row, const Coefficients& k);
+
+// =============================================================================
+// Scalar path (also converts the tail of every SIMD row)
+// =============================================================================
+
+inline int32_t clamp_u8(int32_t value) {
+  return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+inline uint32_t pack_rgba(int32_t y, int32_t u, int32_t v,
+                          const Coefficients& k) {
+  const int32_t luma = (y - k.y_offset) * k.y + (1 << 15);
+  u -= k.c_offset;
+  v -= k.c_offset;
+  const int32_t r = clamp_u8((luma + k.r_v * v) >> 16);
+  const int32_t g = clamp_u8((luma - k.g_u * u - k.g_v * v) >> 16);
+  const int32_t b = clamp_u8((luma + k.b_u * u) >> 16);
+  return static_cast<uint32_t>(r) | (static_cast<uint32_t>(g) << 8) |
+         (static_cast<uint32_t>(b) << 16) | 0xFF000000u;
+}
+
+template <YuvFormat F>
+void convert_row_scalar_from(const Row& row, const Coefficients& k, int x) {
+  for (; x < row.width; x++) {
+    const int c = x >> 1;
+    int32_t y, u, v;
+    if (F == YUV_FORMAT_I420) {
+      y = row.y[x];
+      u = row.u[c];
+      v = row.v[c];
+    } else if (F == YUV_FORMAT_NV12) {
+      y = row.y[x];
+      u = row.u[2 * c];
+      v = row.u[2 * c + 1];
+    } else {
+      const auto* y16 = reinterpret_cast<const uint16_t*>(row.y);
+      const auto* uv16 = reinterpret_cast<const uint16_t*>(row.u);
+      y = y16[x] >> 6;
+      u = uv16[2 * c] >> 6;
+      v = uv16[2 * c + 1] >> 6;
+    }
+    row.dst[x] = pack_rgba(y, u, v, k);
+  }
+}
+
+template <YuvFormat F>
+void convert_row_scalar(const Row& row, const Coefficients& k) {
+  convert_row_scalar_from<F>(row, k, 0);
+}
+
+#ifdef YUV_CONVERTER_X86
+
+inline int32_t load_u32(const uint8_t* p) {
+  int32_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline int32_t load_u16(const uint8_t* p) {
+  uint16_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+// =============================================================================
+// SSE4.1 path: 4 pixels per iteration in 32-bit lanes
+// =============================================================================
+
+__attribute__((target("sse4.1"))) inline __m128i pack_rgba_sse41(
+    __m128i y, __m128i u, __m128i v, const Coefficients& k) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i max = _mm_set1_epi32(255);
+  const __m128i luma = _mm_add_epi32(
+      _mm_mullo_epi32(_mm_sub_epi32(y, _mm_set1_epi32(k.y_offset)),
+                      _mm_set1_epi32(k.y)),
+      _mm_set1_epi32(1 << 15));
+  u = _mm_sub_epi32(u, _mm_set1_epi32(k.c_offset));
+  v = _mm_sub_epi32(v, _mm_set1_epi32(k.c_offset));
+
+  __m128i r = _mm_add_epi32(luma, _mm_mullo_epi32(v, _mm_set1_epi32(k.r_v)));
+  __m128i g = _mm_sub_epi32(
+      _mm_sub_epi32(luma, _mm_mullo_epi32(u, _mm_set1_epi32(k.g_u))),
+      _mm_mullo_epi32(v, _mm_set1_epi32(k.g_v)));
+  __m128i b = _mm_add_epi32(luma, _mm_mullo_epi32(u, _mm_set1_epi32(k.b_u)));
+  r = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(r, 16), zero), max);
+  g = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(g, 16), zero), max);
+  b = _mm_min_epi32(_mm_max_epi32(_mm_srai_epi32(b, 16), zero), max);
+
+  return _mm_or_si128(
+      _mm_or_si128(r, _mm_slli_epi32(g, 8)),
+      _mm_or_si128(_mm_slli_epi32(b, 16),
+                   _mm_set1_epi32(static_cast<int32_t>(0xFF000000u))));
+}
+
+template <YuvFormat F>
+__attribute__((target("sse4.1"))) void convert_row_sse41(
+    const Row& row, const Coefficients& k) {
+  int x = 0;
+  for (; x + 4 <= row.width; x += 4) {
+    __m128i y, u, v;
+    if (F == YUV_FORMAT_I420) {
+      y = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(load_u32(row.y + x)));
+      u = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(load_u16(row.u + x / 2)));
+      v = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(load_u16(row.v + x / 2)));
+      u = _mm_shuffle_epi32(u, _MM_SHUFFLE(1, 1, 0, 0));
+      v = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 0, 0));
+    } else if (F == YUV_FORMAT_NV12) {
+      y = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(load_u32(row.y + x)));
+      const __m128i uv =
+          _mm_cvtepu8_epi32(_mm_cvtsi32_si128(load_u32(row.u + x)));
+      u = _mm_shuffle_epi32(uv, _MM_SHUFFLE(2, 2, 0, 0));
+      v = _mm_shuffle_epi32(uv, _MM_SHUFFLE(3, 3, 1, 1));
+    } else {
+      y = _mm_srli_epi32(
+          _mm_cvtepu16_epi32(_mm_loadl_epi64(
+              reinterpret_cast<const __m128i*>(row.y + x * 2))),
+          6);
+      const __m128i uv = _mm_srli_epi32(
+          _mm_cvtepu16_epi32(_mm_loadl_epi64(
+              reinterpret_cast<const __m128i*>(row.u + x * 2))),
+          6);
+      u = _mm_shuffle_epi32(uv, _MM_SHUFFLE(2, 2, 0, 0));
+      v = _mm_shuffle_epi32(uv, _MM_SHUFFLE(3, 3, 1, 1));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(row.dst + x),
+                     pack_rgba_sse41(y, u, v, k));
+  }
+  convert_row_scalar_from<F>(row, k, x);
+}
+
+// =============================================================================
+// AVX2 path: 8 pixels per iteration in 32-bit lanes
+// =============================================================================
+
+__attribute__((target("avx2"))) inline __m256i pack_rgba_avx2(
+    __m256i y, __m256i u, __m256i v, const Coefficients& k) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i max = _mm256_set1_epi32(255);
+  const __m256i luma = _mm256_add_epi32(
+      _mm256_mullo_epi32(_mm256_sub_epi32(y, _mm256_set1_epi32(k.y_offset)),
+                         _mm256_set1_epi32(k.y)),
+      _mm256_set1_epi32(1 << 15));
+  u = _mm256_sub_epi32(u, _mm256_set1_epi32(k.c_offset));
+  v = _mm256_sub_epi32(v, _mm256_set1_epi32(k.c_offset));
+
+  __m256i r =
+      _mm256_add_epi32(luma, _mm256_mullo_epi32(v, _mm256_set1_epi32(k.r_v)));
+  __m256i g = _mm256_sub_epi32(
+      _mm256_sub_epi32(luma, _mm256_mullo_epi32(u, _mm256_set1_epi32(k.g_u))),
+      _mm256_mullo_epi32(v, _mm256_set1_epi32(k.g_v)));
+  __m256i b =
+      _mm256_add_epi32(luma, _mm256_mullo_epi32(u, _mm256_set1_epi32(k.b_u)));
+  r = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(r, 16), zero), max);
+  g = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(g, 16), zero), max);
+  b = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(b, 16), zero), max);
+
+  return _mm256_or_si256(
+      _mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+      _mm256_or_si256(_mm256_slli_epi32(b, 16),
+                      _mm256_set1_epi32(static_cast<int32_t>(0xFF000000u))));
+}
+
+template <YuvFormat F>
+__attribute__((target("avx2"))) void convert_row_avx2(const Row& row,
+                                                       const Coefficients& k) {
+  // Chroma lanes are widened once and then duplicated (or split, for
+  // interleaved UV) across the pixel pairs that share them.
+  const __m256i dup_low = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+  const __m256i even = _mm256_setr_epi32(0, 0, 2, 2, 4, 4, 6, 6);
+  const __m256i odd = _mm256_setr_epi32(1, 1, 3, 3, 5, 5, 7, 7);
+
+  int x = 0;
+  for (; x + 8 <= row.width; x += 8) {
+    __m256i y, u, v;
+    if (F == YUV_FORMAT_I420) {
+      y = _mm256_cvtepu8_epi32(
+          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row.y + x)));
+      u = _mm256_cvtepu8_epi32(_mm_cvtsi32_si128(load_u32(row.u + x / 2)));
+      v = _mm256_cvtepu8_epi32(_mm_cvtsi32_si128(load_u32(row.v + x / 2)));
+      u = _mm256_permutevar8x32_epi32(u, dup_low);
+      v = _mm256_permutevar8x32_epi32(v, dup_low);
+    } else if (F == YUV_FORMAT_NV12) {
+      y = _mm256_cvtepu8_epi32(
+          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row.y + x)));
+      const __m256i uv = _mm256_cvtepu8_epi32(
+          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row.u + x)));
+      u = _mm256_permutevar8x32_epi32(uv, even);
+      v = _mm256_permutevar8x32_epi32(uv, odd);
+    } else {
+      y = _mm256_srli_epi32(
+          _mm256_cvtepu16_epi32(_mm_loadu_si128(
+              reinterpret_cast<const __m128i*>(row.y + x * 2))),
+          6);
+      const __m256i uv = _mm256_srli_epi32(
+          _mm256_cvtepu16_epi32(_mm_loadu_si128(
+              reinterpret_cast<const __m128i*>(row.u + x * 2))),
+          6);
+      u = _mm256_permutevar8x32_epi32(uv, even);
+      v = _mm256_permutevar8x32_epi32(uv, odd);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(row.dst + x),
+                        pack_rgba_avx2(y, u, v, k));
+  }
+  convert_row_scalar_from<F>(row, k, x);
+}
+
+#endif  // YUV_CONVERTER_X86
+
+// =============================================================================
+// Runtime dispatch
+// =============================================================================
+
+struct Backend {
+  const char* name;
+  RowFunc rows[3];  // indexed by YuvFormat
+};
+
+Backend select_backend() {
+#ifdef YUV_CONVERTER_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return {"avx2",
+            {convert_row_avx2<YUV_FORMAT_I420>,
+             convert_row_avx2<YUV_FORMAT_NV12>,
+             convert_row_avx2<YUV_FORMAT_P010>}};
+  }
+  if (__builtin_cpu_supports("sse4.1")) {
+    return {"sse4.1",
+            {convert_row_sse41<YUV_FORMAT_I420>,
+             convert_row_sse41<YUV_FORMAT_NV12>,
+             convert_row_sse41<YUV_FORMAT_P010>}};
+  }
+#endif
+  return {"scalar",
+          {convert_row_scalar<YUV_FORMAT_I420>,
+           convert_row_scalar<YUV_FORMAT_NV12>,
+           convert_row_scalar<YUV_FORMAT_P010>}};
+}
+
+const Backend& backend() {
+  static const Backend selected = select_backend();
+  return selected;
+}
+
+// =============================================================================
+// Banded multithreading
+// =============================================================================
+
+// Bands smaller than this cost more to hand off than to convert.
+const int kMinBandRows = 32;
+const guint kMaxBands = 32;
+
+struct BandSet {
+  GMutex lock;
+  GCond done;
+  guint pending;
+};
+
+struct Band {
+  const YuvFrame* src;
+  uint8_t* dst;
+  int dst_stride;
+  int first_row;
+  int end_row;
+  const Coefficients* k;
+  RowFunc convert_row;
+  BandSet* set;
+};
+
+void convert_rows(const Band& band) {
+  const YuvFrame* src = band.src;
+  Row row;
+  row.width = src->width;
+  row.v = nullptr;
+  for (int y = band.first_row; y < band.end_row; y++) {
+    const int chroma_y = y >> 1;
+    row.y = src->planes[0] + static_cast<ptrdiff_t>(y) * src->strides[0];
+    row.u = src->planes[1] + static_cast<ptrdiff_t>(chroma_y) * src->strides[1];
+    if (src->format == YUV_FORMAT_I420) {
+      row.v =
+          src->planes[2] + static_cast<ptrdiff_t>(chroma_y) * src->strides[2];
+    }
+    row.dst = reinterpret_cast<uint32_t*>(
+        band.dst + static_cast<ptrdiff_t>(y) * band.dst_stride);
+    band.convert_row(row, *band.k);
+  }
+}
+
+void band_worker(gpointer data, gpointer user_data) {
+  auto* band = static_cast<Band*>(data);
+  convert_rows(*band);
+  BandSet* set = band->set;
+  g_mutex_lock(&set->lock);
+  if (--set->pending == 0) g_cond_signal(&set->done);
+  g_mutex_unlock(&set->lock);
+}
+
+GThreadPool* band_pool() {
+  static GThreadPool* pool = g_thread_pool_new(
+      band_worker, nullptr, static_cast<gint>(g_get_num_processors()), FALSE,
+      nullptr);
+  return pool;
+}
+
+}  // namespace
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+void yuv_convert_to_rgba(const YuvFrame* src,
+                         uint8_t* dst,
+                         int dst_stride,
+                         guint n_threads) {
+  const int bit_depth = src->format == YUV_FORMAT_P010 ? 10 : 8;
+  const Coefficients k =
+      make_coefficients(src->matrix, src->full_range, bit_depth);
+  const RowFunc convert_row = backend().rows[src->format];
+
+  guint n_bands = MIN(n_threads, kMaxBands);
+  n_bands = MIN(n_bands, static_cast<guint>(src->height / kMinBandRows));
+  if (n_bands <= 1) {
+    convert_rows({src, dst, dst_stride, 0, src->height, &k, convert_row,
+                  nullptr});
+    return;
+  }
+
+  // Even band heights keep each 4:2:0 chroma row inside a single band.
+  const int band_rows = ((src->height + n_bands - 1) / n_bands + 1) & ~1;
+  BandSet set;
+  g_mutex_init(&set.lock);
+  g_cond_init(&set.done);
+  set.pending = 0;
+
+  Band bands[kMaxBands];
+  guint count = 0;
+  for (int y = 0; y < src->height; y += band_rows) {
+    bands[count] = {src,       dst,         dst_stride,
+                    y,         MIN(y + band_rows, src->height),
+                    &k,        convert_row, &set};
+    count++;
+  }
+
+  set.pending = count - 1;
+  GThreadPool* pool = band_pool();
+  for (guint i = 1; i < count; i++) {
+    g_thread_pool_push(pool, &bands[i], nullptr);
+  }
+  convert_rows(bands[0]);
+
+  g_mutex_lock(&set.lock);
+  while (set.pending > 0) g_cond_wait(&set.done, &set.lock);
+  g_mutex_unlock(&set.lock);
+  g_cond_clear(&set.done);
+  g_mutex_clear(&set.lock);
+}
+
+const char* yuv_converter_backend_name() {
+  return backend().name;
+}
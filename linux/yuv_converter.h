@@ -0,0 +1,49 @@
+#ifndef YUV_CONVERTER_H_
+#define YUV_CONVERTER_H_
+
+#include <glib.h>
+
+#include <cstdint>
+
+// 4:2:0 layouts the converter understands.
+typedef enum {
+  YUV_FORMAT_I420,  // 8-bit Y, U, V planes
+  YUV_FORMAT_NV12,  // 8-bit Y plane, interleaved UV plane
+  YUV_FORMAT_P010,  // 16-bit little-endian Y and UV planes, 10 bits in the MSBs
+} YuvFormat;
+
+typedef enum {
+  YUV_MATRIX_BT601,
+  YUV_MATRIX_BT709,
+  YUV_MATRIX_BT2020,
+} YuvMatrix;
+
+// A mapped source frame. planes/strides follow the GstVideoFrame layout: for
+// NV12 and P010 only planes[0] and planes[1] are used. Strides are in bytes.
+typedef struct {
+  YuvFormat format;
+  YuvMatrix matrix;
+  gboolean full_range;
+  int width;
+  int height;
+  const uint8_t* planes[3];
+  int strides[3];
+} YuvFrame;
+
+// Converts |src| to RGBA (alpha = 255) straight into |dst|, which holds
+// src->height rows of dst_stride bytes. Picks the widest SIMD path the CPU
+// supports (AVX2, SSE4.1, scalar) on first use.
+//
+// With n_threads > 1 the frame is split into horizontal bands; the calling
+// thread converts one and the rest run on a process-wide pool capped at the
+// number of cores, shared by every player.
+void yuv_convert_to_rgba(const YuvFrame* src,
+                         uint8_t* dst,
+                         int dst_stride,
+                         guint n_threads);
+
+// Name of the selected code path ("avx2", "sse4.1" or "scalar"), logged
+// with g_debug when a player turns native conversion on.
+const char* yuv_converter_backend_name();
+
+#endif  // YUV_CONVERTER_H_
@@ -36,7 +36,8 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
     // MARK: - AvPlayerHostApi — Lifecycle
     // =========================================================================
 
-    func create(source: VideoSourceMessage, completion: @escaping (Result<Int64, Error>) -> Void) {
+    func create(source: VideoSourceMessage, completion: @escaping (Result<CreateResultMessage, Error>) -> Void) {
+        let start = DispatchTime.now().uptimeNanoseconds
         let videoURL: URL
 
         switch source.type {
@@ -127,7 +128,8 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         instance.startDisplayLink()
 
         players[textureId] = instance
-        completion(.success(textureId))
+        let latencyUs = Int64((DispatchTime.now().uptimeNanoseconds - start) / 1000)
+        completion(.success(CreateResultMessage(playerId: textureId, createLatencyUs: latencyUs)))
     }
 
     func dispose(playerId: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
@@ -141,6 +143,17 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         registrar.textures.unregisterTexture(playerId)
     }
 
+    // Seek tolerances for a seek mode: zero on both sides for an accurate
+    // seek, unbounded on the side a keyframe may be picked from.
+    private func seekTolerances(_ mode: SeekMode) -> (CMTime, CMTime) {
+        switch mode {
+        case .accurate: return (.zero, .zero)
+        case .keyframeBefore: return (.positiveInfinity, .zero)
+        case .keyframeAfter: return (.zero, .positiveInfinity)
+        case .nearestKeyframe: return (.positiveInfinity, .positiveInfinity)
+        }
+    }
+
     // =========================================================================
     // MARK: - AvPlayerHostApi — Playback
     // =========================================================================
@@ -166,13 +179,14 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         completion(.success(()))
     }
 
-    func seekTo(playerId: Int64, positionMs: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
+    func seekTo(playerId: Int64, positionMs: Int64, mode: SeekMode, completion: @escaping (Result<Void, Error>) -> Void) {
         guard let instance = players[playerId] else {
             completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
             return
         }
         let time = CMTime(value: positionMs, timescale: 1000)
-        instance.player.seek(to: time, toleranceBefore: .zero, toleranceAfter: .zero) { _ in
+        let (before, after) = seekTolerances(mode)
+        instance.player.seek(to: time, toleranceBefore: before, toleranceAfter: after) { _ in
             completion(.success(()))
         }
     }
@@ -284,6 +298,84 @@ public class AvPlayerPlugin: NSObject, FlutterPlugin, AvPlayerHostApi {
         completion(.success(()))
     }
 
+    func setRenderSize(playerId: Int64, width: Int64, height: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
+        guard players[playerId] != nil else {
+            completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
+            return
+        }
+        // AVPlayerItemVideoOutput frames are handed to Flutter as
+        // IOSurface-backed pixel buffers and scaled on the GPU.
+        completion(.success(()))
+    }
+
+    func setNativeColorConversion(playerId: Int64, enabled: Bool, completion: @escaping (Result<Void, Error>) -> Void) {
+        guard players[playerId] != nil else {
+            completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
+            return
+        }
+        // AVPlayerItemVideoOutput already delivers BGRA converted by
+        // VideoToolbox.
+        completion(.success(()))
+    }
+
+    func setConversionThreads(playerId: Int64, threads: Int64, completion: @escaping (Result<Void, Error>) -> Void) {
+        guard players[playerId] != nil else {
+            completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
+            return
+        }
+        // VideoToolbox schedules conversion work itself.
+        completion(.success(()))
+    }
+
+    func getRenderStats(playerId: Int64, completion: @escaping (Result<RenderStatsMessage, Error>) -> Void) {
+        guard players[playerId] != nil else {
+            completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
+            return
+        }
+        // AVPlayerItemVideoOutput hands frames to the engine without a
+        // conversion or copy step to time.
+        completion(.success(RenderStatsMessage(
+            framesDecoded: 0, framesPresented: 0, framesDropped: 0,
+            conversionP50Us: 0, conversionP95Us: 0, conversionP99Us: 0,
+            copyP50Us: 0, copyP95Us: 0, copyP99Us: 0,
+            latenessP50Us: 0, latenessP95Us: 0, latenessP99Us: 0,
+            audioFilterP50Us: 0, audioFilterP95Us: 0, audioFilterP99Us: 0
+        )))
+    }
+
+    func getKeyframes(playerId: Int64, completion: @escaping (Result<[Int64], Error>) -> Void) {
+        guard players[playerId] != nil else {
+            completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
+            return
+        }
+        // AVPlayer does not expose sync samples; seeks can still snap
+        // through the seek tolerances.
+        completion(.success([]))
+    }
+
+    func queueNext(playerId: Int64, source: VideoSourceMessage, completion: @escaping (Result<Bool, Error>) -> Void) {
+        guard players[playerId] != nil else {
+            completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
+            return
+        }
+        // Needs AVQueuePlayer; the playlist falls back to a new player.
+        completion(.success(false))
+    }
+
+    func preload(source: VideoSourceMessage, completion: @escaping (Result<Void, Error>) -> Void) {
+        // No warm pool yet; create() loads the source as usual.
+        completion(.success(()))
+    }
+
+    func setSource(playerId: Int64, source: VideoSourceMessage, completion: @escaping (Result<Bool, Error>) -> Void) {
+        guard players[playerId] != nil else {
+            completion(.failure(PigeonError(code: "NO_PLAYER", message: "Player \(playerId) not found.", details: nil)))
+            return
+        }
+        // Not supported yet; callers create a new player.
+        completion(.success(false))
+    }
+
     // =========================================================================
     // MARK: - AvPlayerHostApi — Performance
     // =========================================================================
@@ -6,6 +6,7 @@ import 'package:pigeon/pigeon.dart';
   kotlinOut:
       'android/src/main/kotlin/com/flutterplaza/avplayer/Messages.g.kt',
   kotlinOptions: KotlinOptions(package: 'com.flutterplaza.avplayer'),
+  // Copy to macos/av_player/Sources/av_player/ after generating.
   swiftOut: 'ios/av_player/Sources/av_player/Messages.g.swift',
   cppHeaderOut: 'windows/messages.g.h',
   cppSourceOut: 'windows/messages.g.cpp',
@@ -25,6 +26,13 @@ enum SourceType {
   file,
 }
 
+enum SeekMode {
+  accurate,
+  keyframeBefore,
+  keyframeAfter,
+  nearestKeyframe,
+}
+
 // ---------------------------------------------------------------------------
 // Data classes
 // ---------------------------------------------------------------------------
@@ -136,6 +144,95 @@ class SelectSubtitleTrackRequest {
   final String? trackId; // null = disable subtitles
 }
 
+// ---------------------------------------------------------------------------
+// Rendering data classes
+// ---------------------------------------------------------------------------
+
+class RenderStatsMessage {
+  RenderStatsMessage({
+    required this.framesDecoded,
+    required this.framesPresented,
+    required this.framesDropped,
+    required this.conversionP50Us,
+    required this.conversionP95Us,
+    required this.conversionP99Us,
+    required this.copyP50Us,
+    required this.copyP95Us,
+    required this.copyP99Us,
+    required this.latenessP50Us,
+    required this.latenessP95Us,
+    required this.latenessP99Us,
+    required this.audioFilterP50Us,
+    required this.audioFilterP95Us,
+    required this.audioFilterP99Us,
+  });
+
+  final int framesDecoded;
+  final int framesPresented;
+  final int framesDropped;
+  // Percentiles in microseconds.
+  final int conversionP50Us;
+  final int conversionP95Us;
+  final int conversionP99Us;
+  final int copyP50Us;
+  final int copyP95Us;
+  final int copyP99Us;
+  final int latenessP50Us;
+  final int latenessP95Us;
+  final int latenessP99Us;
+  // CPU time of the audio time-stretch filter per buffer.
+  final int audioFilterP50Us;
+  final int audioFilterP95Us;
+  final int audioFilterP99Us;
+}
+
+// ---------------------------------------------------------------------------
+// Lifecycle data classes
+// ---------------------------------------------------------------------------
+
+class CreateResultMessage {
+  CreateResultMessage({
+    required this.playerId,
+    required this.createLatencyUs,
+  });
+
+  final int playerId;
+  // Time the platform took to create the player, in microseconds.
+  final int createLatencyUs;
+}
+
+// ---------------------------------------------------------------------------
+// Event data classes
+// ---------------------------------------------------------------------------
+
+// Periodic events sent through AvPlayerEventApi instead of the per-player
+// event channel, so they skip the string-keyed map encoding.
+
+class ClockAnchorMessage {
+  ClockAnchorMessage({
+    required this.playerId,
+    required this.positionMs,
+    required this.rate,
+    required this.timestampUs,
+  });
+
+  final int playerId;
+  final int positionMs;
+  final double rate;
+  // Monotonic clock, microseconds.
+  final int timestampUs;
+}
+
+class StateUpdateMessage {
+  StateUpdateMessage({
+    required this.playerId,
+    required this.bufferedMs,
+  });
+
+  final int playerId;
+  final int bufferedMs;
+}
+
 // ---------------------------------------------------------------------------
 // Host API
 // ---------------------------------------------------------------------------
@@ -144,7 +241,7 @@ class SelectSubtitleTrackRequest {
 abstract class AvPlayerHostApi {
   // Lifecycle
   @async
-  int create(VideoSourceMessage source);
+  CreateResultMessage create(VideoSourceMessage source);
 
   @async
   void dispose(int playerId);
@@ -157,7 +254,7 @@ abstract class AvPlayerHostApi {
   void pause(int playerId);
 
   @async
-  void seekTo(int playerId, int positionMs);
+  void seekTo(int playerId, int positionMs, SeekMode mode);
 
   @async
   void setPlaybackSpeed(int playerId, double speed);
@@ -214,4 +311,37 @@ abstract class AvPlayerHostApi {
 
   @async
   void selectSubtitleTrack(SelectSubtitleTrackRequest request);
+
+  // Rendering
+  @async
+  void setRenderSize(int playerId, int width, int height);
+
+  @async
+  void setNativeColorConversion(int playerId, bool enabled);
+
+  @async
+  void setConversionThreads(int playerId, int threads);
+
+  @async
+  RenderStatsMessage getRenderStats(int playerId);
+
+  @async
+  List<int> getKeyframes(int playerId);
+
+  // Returns false when the platform cannot switch sources in place.
+  @async
+  bool queueNext(int playerId, VideoSourceMessage source);
+
+  @async
+  void preload(VideoSourceMessage source);
+
+  @async
+  bool setSource(int playerId, VideoSourceMessage source);
+}
+
+@FlutterApi()
+abstract class AvPlayerEventApi {
+  void onClockAnchor(ClockAnchorMessage anchor);
+
+  void onStateUpdate(StateUpdateMessage update);
 }
@@ -1,3 +1,5 @@
+import 'dart:async';
+
 import 'package:av_player/av_player.dart';
 import 'package:flutter/material.dart';
 import 'package:flutter_test/flutter_test.dart';
@@ -360,6 +362,67 @@ void main() {
 
       controller.dispose();
     });
+
+    testWidgets('dragging slider seeks to keyframes, then accurately on release',
+        (tester) async {
+      final controller = await createInitializedController(mockPlatform);
+      mockPlatform.seekModeLog.clear();
+
+      await tester.pumpWidget(wrapWithApp(SizedBox.expand(
+        child: AVControls(controller: controller),
+      )));
+      await tester.pump();
+
+      await tester.drag(find.byType(Slider), const Offset(100, 0));
+      await tester.pump();
+
+      expect(mockPlatform.seekModeLog.length, greaterThan(1));
+      expect(
+        mockPlatform.seekModeLog.take(mockPlatform.seekModeLog.length - 1),
+        everyElement(AVSeekMode.nearestKeyframe),
+      );
+      expect(mockPlatform.seekModeLog.last, AVSeekMode.accurate);
+
+      controller.dispose();
+    });
+
+    testWidgets('dragging slider keeps one keyframe seek outstanding',
+        (tester) async {
+      final controller = await createInitializedController(mockPlatform);
+      mockPlatform.seekLog.clear();
+      mockPlatform.seekModeLog.clear();
+      mockPlatform.seekGate = Completer<void>();
+
+      await tester.pumpWidget(wrapWithApp(SizedBox.expand(
+        child: AVControls(controller: controller),
+      )));
+      await tester.pump();
+
+      final gesture =
+          await tester.startGesture(tester.getCenter(find.byType(Slider)));
+      for (var i = 0; i < 5; i++) {
+        await gesture.moveBy(const Offset(20, 0));
+        await tester.pump();
+      }
+      expect(mockPlatform.seekModeLog, [AVSeekMode.nearestKeyframe]);
+
+      // The newest target is issued once the outstanding seek returns.
+      final latest = Duration(
+        milliseconds: tester.widget<Slider>(find.byType(Slider)).value.toInt(),
+      );
+      mockPlatform.seekGate!.complete();
+      mockPlatform.seekGate = null;
+      await tester.pump();
+      expect(mockPlatform.seekModeLog,
+          [AVSeekMode.nearestKeyframe, AVSeekMode.nearestKeyframe]);
+      expect(mockPlatform.seekLog.last, latest);
+
+      await gesture.up();
+      await tester.pump();
+      expect(mockPlatform.seekModeLog.last, AVSeekMode.accurate);
+
+      controller.dispose();
+    });
   });
 
   // ---------------------------------------------------------------------------
@@ -28,7 +28,11 @@ class _MockPlatform extends AvPlayerPlatform {
   Future<void> pause(int playerId) async => log.add('pause');
 
   @override
-  Future<void> seekTo(int playerId, Duration position) async =>
+  Future<void> seekTo(
+    int playerId,
+    Duration position, {
+    AVSeekMode mode = AVSeekMode.accurate,
+  }) async =>
       log.add('seekTo');
 
   @override
@@ -89,6 +93,46 @@ class _MockPlatform extends AvPlayerPlatform {
     log.add('selectSubtitleTrack');
   }
 
+  @override
+  Future<void> setRenderSize(int playerId, int width, int height) async =>
+      log.add('setRenderSize');
+
+  @override
+  Future<void> setNativeColorConversion(int playerId, bool enabled) async =>
+      log.add('setNativeColorConversion');
+
+  @override
+  Future<void> setConversionThreads(int playerId, int threads) async =>
+      log.add('setConversionThreads');
+
+  @override
+  Future<AVRenderStats> getRenderStats(int playerId) async {
+    log.add('getRenderStats');
+    return AVRenderStats.empty;
+  }
+
+  @override
+  Future<List<Duration>> getKeyframes(int playerId) async {
+    log.add('getKeyframes');
+    return const [];
+  }
+
+  @override
+  Future<bool> queueNext(int playerId, AVVideoSource source) async {
+    log.add('queueNext');
+    return false;
+  }
+
+  @override
+  Future<void> preload(AVVideoSource source) async =>
+      log.add('preload');
+
+  @override
+  Future<bool> setSource(int playerId, AVVideoSource source) async {
+    log.add('setSource');
+    return false;
+  }
+
   @override
   Stream<AVPlayerEvent> playerEvents(int playerId) {
     _eventController = StreamController<AVPlayerEvent>();
@@ -256,6 +300,96 @@ void main() {
       controller.dispose();
     });
 
+    test('setRenderSize() calls platform', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      await controller.setRenderSize(640, 360);
+      expect(mockPlatform.log, contains('setRenderSize'));
+      controller.dispose();
+    });
+
+    test('setNativeColorConversion() calls platform', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      await controller.setNativeColorConversion(true);
+      expect(mockPlatform.log, contains('setNativeColorConversion'));
+      controller.dispose();
+    });
+
+    test('setConversionThreads() calls platform', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      await controller.setConversionThreads(2);
+      expect(mockPlatform.log, contains('setConversionThreads'));
+      controller.dispose();
+    });
+
+    test('getRenderStats() calls platform', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      final stats = await controller.getRenderStats();
+      expect(stats.framesDecoded, 0);
+      expect(mockPlatform.log, contains('getRenderStats'));
+      controller.dispose();
+    });
+
+    test('getKeyframes() calls platform', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      expect(await controller.getKeyframes(), isEmpty);
+      expect(mockPlatform.log, contains('getKeyframes'));
+      controller.dispose();
+    });
+
+    test('queueNext() calls platform', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      expect(
+        await controller.queueNext(
+          const AVVideoSource.network('https://example.com/next.mp4'),
+        ),
+        isFalse,
+      );
+      expect(mockPlatform.log, contains('queueNext'));
+      controller.dispose();
+    });
+
+    test('preload() calls platform for each source', () async {
+      await AVPlayerController.preload(const [
+        AVVideoSource.network('https://example.com/a.mp4'),
+        AVVideoSource.network('https://example.com/b.mp4'),
+      ]);
+      expect(
+        mockPlatform.log.where((call) => call == 'preload'),
+        hasLength(2),
+      );
+    });
+
+    test('setSource() calls platform', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      final swapped = await controller.setSource(
+        const AVVideoSource.network('https://example.com/next.mp4'),
+      );
+      expect(swapped, isFalse);
+      expect(mockPlatform.log, contains('setSource'));
+      controller.dispose();
+    });
+
     test('handles initialized event', () async {
       final controller = AVPlayerController(
         const AVVideoSource.network('https://example.com/video.mp4'),
@@ -286,6 +420,133 @@ void main() {
       controller.dispose();
     });
 
+    test('handles stateUpdate event', () async {
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      mockPlatform.emitEvent(const AVPositionChangedEvent(
+        position: Duration(seconds: 5),
+      ));
+      mockPlatform.emitEvent(const AVStateUpdateEvent(
+        buffered: Duration(seconds: 30),
+      ));
+      await Future<void>.delayed(Duration.zero);
+      expect(controller.value.position, const Duration(seconds: 5));
+      expect(controller.value.buffered, const Duration(seconds: 30));
+      controller.dispose();
+    });
+
+    test('extrapolates currentPosition from clock anchors', () async {
+      var now = 10000000;
+      final monotonicMicros = AVPlayerController.monotonicMicros;
+      AVPlayerController.monotonicMicros = () => now;
+      addTearDown(() => AVPlayerController.monotonicMicros = monotonicMicros);
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      mockPlatform.emitEvent(const AVClockAnchorEvent(
+        position: Duration(seconds: 5),
+        rate: 1.0,
+        timestampUs: 10000000,
+      ));
+      await Future<void>.delayed(Duration.zero);
+      expect(controller.value.position, const Duration(seconds: 5));
+      now += 250000;
+      expect(controller.currentPosition, const Duration(milliseconds: 5250));
+
+      mockPlatform.emitEvent(AVClockAnchorEvent(
+        position: const Duration(milliseconds: 5250),
+        rate: 0,
+        timestampUs: now,
+      ));
+      await Future<void>.delayed(Duration.zero);
+      now += 1000000;
+      expect(controller.currentPosition, const Duration(milliseconds: 5250));
+      expect(controller.value.position, const Duration(milliseconds: 5250));
+      controller.dispose();
+    });
+
+    test('extrapolates clock anchors from when they arrive', () async {
+      var now = 10000000;
+      final monotonicMicros = AVPlayerController.monotonicMicros;
+      AVPlayerController.monotonicMicros = () => now;
+      addTearDown(() => AVPlayerController.monotonicMicros = monotonicMicros);
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      // Stamped on a platform clock unrelated to the Dart one.
+      mockPlatform.emitEvent(const AVClockAnchorEvent(
+        position: Duration(seconds: 5),
+        rate: 1.0,
+        timestampUs: -1,
+      ));
+      await Future<void>.delayed(Duration.zero);
+      expect(controller.currentPosition, const Duration(seconds: 5));
+      now += 250000;
+      expect(controller.currentPosition, const Duration(milliseconds: 5250));
+      controller.dispose();
+    });
+
+    test('dates back clock anchors that arrive late', () async {
+      var now = 10000000;
+      final monotonicMicros = AVPlayerController.monotonicMicros;
+      AVPlayerController.monotonicMicros = () => now;
+      addTearDown(() => AVPlayerController.monotonicMicros = monotonicMicros);
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await controller.initialize();
+      mockPlatform.emitEvent(const AVClockAnchorEvent(
+        position: Duration(seconds: 5),
+        rate: 1.0,
+        timestampUs: 1000,
+      ));
+      await Future<void>.delayed(Duration.zero);
+
+      // Sent 500 ms later on the platform clock, delivered 40 ms slower.
+      now += 540000;
+      mockPlatform.emitEvent(const AVClockAnchorEvent(
+        position: Duration(seconds: 6),
+        rate: 1.0,
+        timestampUs: 501000,
+      ));
+      await Future<void>.delayed(Duration.zero);
+      expect(controller.currentPosition, const Duration(milliseconds: 6040));
+      controller.dispose();
+    });
+
+    test('default clock advances', () async {
+      final start = AVPlayerController.monotonicMicros();
+      await Future<void>.delayed(const Duration(milliseconds: 5));
+      expect(AVPlayerController.monotonicMicros(), greaterThan(start));
+    });
+
+    test('handles trackChanged event', () async {
+      var trackChanges = 0;
+      final controller = AVPlayerController(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+        onTrackChanged: () => trackChanges++,
+      );
+      await controller.initialize();
+      mockPlatform.emitEvent(const AVPositionChangedEvent(
+        position: Duration(seconds: 59),
+      ));
+      mockPlatform.emitEvent(const AVTrackChangedEvent(
+        duration: Duration(minutes: 3),
+        width: 640,
+        height: 480,
+      ));
+      await Future<void>.delayed(Duration.zero);
+      expect(controller.value.duration, const Duration(minutes: 3));
+      expect(controller.value.position, Duration.zero);
+      expect(controller.value.aspectRatio, closeTo(4 / 3, 0.001));
+      expect(trackChanges, 1);
+      controller.dispose();
+    });
+
     test('handles pipChanged event', () async {
       final controller = AVPlayerController(
         const AVVideoSource.network('https://example.com/video.mp4'),
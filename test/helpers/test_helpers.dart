@@ -10,6 +10,9 @@ import 'package:flutter/material.dart';
 class TestMockPlatform extends AvPlayerPlatform {
   final log = <String>[];
   final seekLog = <Duration>[];
+  final seekModeLog = <AVSeekMode>[];
+  // When set, seekTo() does not return until it completes.
+  Completer<void>? seekGate;
   final speedLog = <double>[];
   StreamController<AVPlayerEvent>? _eventController;
 
@@ -32,9 +35,15 @@ class TestMockPlatform extends AvPlayerPlatform {
   Future<void> pause(int playerId) async => log.add('pause');
 
   @override
-  Future<void> seekTo(int playerId, Duration position) async {
+  Future<void> seekTo(
+    int playerId,
+    Duration position, {
+    AVSeekMode mode = AVSeekMode.accurate,
+  }) async {
     log.add('seekTo');
     seekLog.add(position);
+    seekModeLog.add(mode);
+    await seekGate?.future;
   }
 
   @override
@@ -109,6 +118,46 @@ class TestMockPlatform extends AvPlayerPlatform {
     log.add('selectSubtitleTrack');
   }
 
+  @override
+  Future<void> setRenderSize(int playerId, int width, int height) async =>
+      log.add('setRenderSize');
+
+  @override
+  Future<void> setNativeColorConversion(int playerId, bool enabled) async =>
+      log.add('setNativeColorConversion');
+
+  @override
+  Future<void> setConversionThreads(int playerId, int threads) async =>
+      log.add('setConversionThreads');
+
+  @override
+  Future<AVRenderStats> getRenderStats(int playerId) async {
+    log.add('getRenderStats');
+    return AVRenderStats.empty;
+  }
+
+  @override
+  Future<List<Duration>> getKeyframes(int playerId) async {
+    log.add('getKeyframes');
+    return const [];
+  }
+
+  @override
+  Future<bool> queueNext(int playerId, AVVideoSource source) async {
+    log.add('queueNext');
+    return false;
+  }
+
+  @override
+  Future<void> preload(AVVideoSource source) async =>
+      log.add('preload');
+
+  @override
+  Future<bool> setSource(int playerId, AVVideoSource source) async {
+    log.add('setSource');
+    return false;
+  }
+
   @override
   Stream<AVPlayerEvent> playerEvents(int playerId) {
     _eventController = StreamController<AVPlayerEvent>();
@@ -1,6 +1,9 @@
+import 'dart:async';
+
 import 'package:av_player/src/platform/av_player_linux.dart';
 import 'package:av_player/src/platform/av_player_platform.dart';
 import 'package:av_player/src/platform/generated/messages.g.dart';
+import 'package:flutter/services.dart';
 import 'package:flutter_test/flutter_test.dart';
 
 import 'method_channel_av_player_test.dart';
@@ -15,7 +18,9 @@ void main() {
     setUp(() {
       platform = AvPlayerLinux();
       mock = MockAvPlayerHostApi();
-      mock.setHandler('create', (_) => 42);
+      mock.setHandler(
+          'create',
+          (_) => CreateResultMessage(playerId: 42, createLatencyUs: 1500));
       mock.setHandler('getSystemVolume', (_) => 0.75);
       mock.setHandler('getScreenBrightness', (_) => 0.6);
       mock.setHandler(
@@ -27,6 +32,28 @@ void main() {
               ));
       mock.setHandler('getSubtitleTracks', (_) => <SubtitleTrackMessage>[]);
       mock.setHandler('selectSubtitleTrack', (_) => null);
+      mock.setHandler(
+          'getRenderStats',
+          (_) => RenderStatsMessage(
+                framesDecoded: 120,
+                framesPresented: 110,
+                framesDropped: 10,
+                conversionP50Us: 800,
+                conversionP95Us: 1200,
+                conversionP99Us: 1500,
+                copyP50Us: 200,
+                copyP95Us: 250,
+                copyP99Us: 300,
+                latenessP50Us: 1000,
+                latenessP95Us: 4000,
+                latenessP99Us: 9000,
+                audioFilterP50Us: 40,
+                audioFilterP95Us: 90,
+                audioFilterP99Us: 150,
+              ));
+      mock.setHandler('getKeyframes', (_) => <int>[0, 2000, 4000]);
+      mock.setHandler('queueNext', (_) => true);
+      mock.setHandler('setSource', (_) => true);
       mock.install();
     });
 
@@ -201,6 +228,80 @@ void main() {
       expect(mock.log, ['selectSubtitleTrack']);
     });
 
+    // -----------------------------------------------------------------------
+    // Rendering
+    // -----------------------------------------------------------------------
+
+    test('setRenderSize() sends playerId and size', () async {
+      await platform.setRenderSize(1, 320, 180);
+      expect(mock.log, ['setRenderSize']);
+    });
+
+    test('setNativeColorConversion() sends playerId and flag', () async {
+      await platform.setNativeColorConversion(1, true);
+      expect(mock.log, ['setNativeColorConversion']);
+    });
+
+    test('setConversionThreads() sends playerId and thread count', () async {
+      await platform.setConversionThreads(1, 4);
+      expect(mock.log, ['setConversionThreads']);
+    });
+
+    test('getRenderStats() maps message to AVRenderStats', () async {
+      final stats = await platform.getRenderStats(1);
+      expect(stats.framesDecoded, 120);
+      expect(stats.framesPresented, 110);
+      expect(stats.framesDropped, 10);
+      expect(stats.conversion.p50, const Duration(microseconds: 800));
+      expect(stats.copy.p99, const Duration(microseconds: 300));
+      expect(stats.lateness.p95, const Duration(microseconds: 4000));
+      expect(stats.audioFilter.p99, const Duration(microseconds: 150));
+      expect(mock.log, ['getRenderStats']);
+    });
+
+    test('getRenderStats() includes the create latency', () async {
+      final id = await platform.create(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      final stats = await platform.getRenderStats(id);
+      expect(stats.createLatency, const Duration(microseconds: 1500));
+    });
+
+    test('getKeyframes() maps milliseconds to durations', () async {
+      final keyframes = await platform.getKeyframes(1);
+      expect(keyframes, const [
+        Duration.zero,
+        Duration(seconds: 2),
+        Duration(seconds: 4),
+      ]);
+      expect(mock.log, ['getKeyframes']);
+    });
+
+    test('queueNext() sends the source and returns the result', () async {
+      final queued = await platform.queueNext(
+        1,
+        const AVVideoSource.network('https://example.com/next.mp4'),
+      );
+      expect(queued, isTrue);
+      expect(mock.log, ['queueNext']);
+    });
+
+    test('preload() sends the source', () async {
+      await platform.preload(
+        const AVVideoSource.network('https://example.com/next.mp4'),
+      );
+      expect(mock.log, ['preload']);
+    });
+
+    test('setSource() sends the source and returns the result', () async {
+      final swapped = await platform.setSource(
+        1,
+        const AVVideoSource.network('https://example.com/next.mp4'),
+      );
+      expect(swapped, isTrue);
+      expect(mock.log, ['setSource']);
+    });
+
     // -----------------------------------------------------------------------
     // Events
     // -----------------------------------------------------------------------
@@ -209,5 +310,105 @@ void main() {
       final stream = platform.playerEvents(42);
       expect(stream, isA<Stream<AVPlayerEvent>>());
     });
+
+    group('typed events', () {
+      const eventChannel =
+          EventChannel('com.flutterplaza.av_player_linux/events/42');
+      final messenger =
+          TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger;
+
+      setUp(() {
+        messenger.setMockStreamHandler(
+          eventChannel,
+          MockStreamHandler.inline(onListen: (_, events) {
+            events.success(<String, Object?>{'type': 'completed'});
+          }),
+        );
+      });
+
+      tearDown(() {
+        messenger.setMockStreamHandler(eventChannel, null);
+      });
+
+      Future<void> sendTyped(String method, Object message) {
+        final completer = Completer<void>();
+        messenger.handlePlatformMessage(
+          'dev.flutter.pigeon.av_player.AvPlayerEventApi.$method',
+          AvPlayerEventApi.pigeonChannelCodec.encodeMessage(<Object?>[message]),
+          (_) => completer.complete(),
+        );
+        return completer.future;
+      }
+
+      test('reach playerEvents alongside event channel events', () async {
+        final events = <AVPlayerEvent>[];
+        final subscription = platform.playerEvents(42).listen(events.add);
+        await pumpEventQueue();
+
+        await sendTyped(
+          'onClockAnchor',
+          ClockAnchorMessage(
+            playerId: 42,
+            positionMs: 1500,
+            rate: 1.0,
+            timestampUs: 123456,
+          ),
+        );
+        await sendTyped(
+          'onStateUpdate',
+          StateUpdateMessage(playerId: 42, bufferedMs: 8000),
+        );
+        await sendTyped(
+          'onStateUpdate',
+          StateUpdateMessage(playerId: 7, bufferedMs: 100),
+        );
+        await pumpEventQueue();
+
+        expect(events, hasLength(3));
+        expect(events[0], isA<AVCompletedEvent>());
+        final anchor = events[1] as AVClockAnchorEvent;
+        expect(anchor.position, const Duration(milliseconds: 1500));
+        expect(anchor.rate, 1.0);
+        expect(anchor.timestampUs, 123456);
+        final update = events[2] as AVStateUpdateEvent;
+        expect(update.buffered, const Duration(seconds: 8));
+
+        await subscription.cancel();
+      });
+
+      test('stream closes on dispose', () async {
+        final done = Completer<void>();
+        platform.playerEvents(42).listen(null, onDone: done.complete);
+        await platform.dispose(42);
+        await done.future;
+      });
+
+      test('encode smaller than event channel maps', () {
+        const eventCodec = StandardMethodCodec();
+        const codec = AvPlayerEventApi.pigeonChannelCodec;
+        final anchorMap = eventCodec.encodeSuccessEnvelope(<String, Object?>{
+          'type': 'clockAnchor',
+          'position': 3600000,
+          'rate': 1.0,
+          'timestamp': 987654321012,
+        });
+        final anchor = codec.encodeMessage(<Object?>[
+          ClockAnchorMessage(
+            playerId: 42,
+            positionMs: 3600000,
+            rate: 1.0,
+            timestampUs: 987654321012,
+          ),
+        ])!;
+        final updateMap = eventCodec.encodeSuccessEnvelope(
+            <String, Object?>{'type': 'stateUpdate', 'buffered': 3600000});
+        final update = codec.encodeMessage(<Object?>[
+          StateUpdateMessage(playerId: 42, bufferedMs: 3600000),
+        ])!;
+
+        expect(anchor.lengthInBytes, lessThan(anchorMap.lengthInBytes));
+        expect(update.lengthInBytes, lessThan(updateMap.lengthInBytes));
+      });
+    });
   });
 }
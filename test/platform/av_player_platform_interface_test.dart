@@ -141,6 +141,62 @@ void main() {
           throwsUnimplementedError,
         );
       });
+
+      test('setRenderSize()', () {
+        expect(
+          () => platform.setRenderSize(1, 320, 180),
+          throwsUnimplementedError,
+        );
+      });
+
+      test('setNativeColorConversion()', () {
+        expect(
+          () => platform.setNativeColorConversion(1, true),
+          throwsUnimplementedError,
+        );
+      });
+
+      test('setConversionThreads()', () {
+        expect(
+          () => platform.setConversionThreads(1, 4),
+          throwsUnimplementedError,
+        );
+      });
+
+      test('getRenderStats()', () {
+        expect(
+          () => platform.getRenderStats(1),
+          throwsUnimplementedError,
+        );
+      });
+
+      test('getKeyframes()', () {
+        expect(
+          () => platform.getKeyframes(1),
+          throwsUnimplementedError,
+        );
+      });
+
+      test('queueNext()', () {
+        expect(
+          () => platform.queueNext(1, const AVVideoSource.network('https://example.com/next.mp4')),
+          throwsUnimplementedError,
+        );
+      });
+
+      test('preload()', () {
+        expect(
+          () => platform.preload(const AVVideoSource.network('https://example.com/next.mp4')),
+          throwsUnimplementedError,
+        );
+      });
+
+      test('setSource()', () {
+        expect(
+          () => platform.setSource(1, const AVVideoSource.network('https://example.com/next.mp4')),
+          throwsUnimplementedError,
+        );
+      });
     });
   });
 }
@@ -302,6 +302,77 @@ void main() {
       await expectLater(plugin.selectSubtitleTrack(id, null), completes);
     });
 
+    // =========================================================================
+    // Rendering
+    // =========================================================================
+
+    test('setRenderSize() completes for valid player', () async {
+      final id = await plugin.create(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await expectLater(plugin.setRenderSize(id, 320, 180), completes);
+    });
+
+    test('setNativeColorConversion() completes for valid player', () async {
+      final id = await plugin.create(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await expectLater(plugin.setNativeColorConversion(id, true), completes);
+    });
+
+    test('setConversionThreads() completes for valid player', () async {
+      final id = await plugin.create(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      await expectLater(plugin.setConversionThreads(id, 2), completes);
+    });
+
+    test('getRenderStats() returns empty stats for unknown player',
+        () async {
+      final stats = await plugin.getRenderStats(999);
+      expect(stats.framesDecoded, 0);
+      expect(stats.framesDropped, 0);
+    });
+
+    test('getKeyframes() returns empty list on web', () async {
+      final id = await plugin.create(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      expect(await plugin.getKeyframes(id), isEmpty);
+    });
+
+    test('queueNext() is not supported on web', () async {
+      final id = await plugin.create(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      expect(
+        await plugin.queueNext(
+          id,
+          const AVVideoSource.network('https://example.com/next.mp4'),
+        ),
+        isFalse,
+      );
+    });
+
+    test('preload() is a no-op on web', () async {
+      await plugin.preload(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+    });
+
+    test('setSource() is not supported on web', () async {
+      final id = await plugin.create(
+        const AVVideoSource.network('https://example.com/video.mp4'),
+      );
+      expect(
+        await plugin.setSource(
+          id,
+          const AVVideoSource.network('https://example.com/next.mp4'),
+        ),
+        isFalse,
+      );
+    });
+
     // =========================================================================
     // Events
     // =========================================================================
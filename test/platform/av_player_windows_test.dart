@@ -15,7 +15,9 @@ void main() {
     setUp(() {
       platform = AvPlayerWindows();
       mock = MockAvPlayerHostApi();
-      mock.setHandler('create', (_) => 42);
+      mock.setHandler(
+          'create',
+          (_) => CreateResultMessage(playerId: 42, createLatencyUs: 1500));
       mock.setHandler('getSystemVolume', (_) => 0.75);
       mock.setHandler('getScreenBrightness', (_) => 0.6);
       mock.setHandler(
@@ -27,6 +29,28 @@ void main() {
               ));
       mock.setHandler('getSubtitleTracks', (_) => <SubtitleTrackMessage>[]);
       mock.setHandler('selectSubtitleTrack', (_) => null);
+      mock.setHandler(
+          'getRenderStats',
+          (_) => RenderStatsMessage(
+                framesDecoded: 120,
+                framesPresented: 110,
+                framesDropped: 10,
+                conversionP50Us: 800,
+                conversionP95Us: 1200,
+                conversionP99Us: 1500,
+                copyP50Us: 200,
+                copyP95Us: 250,
+                copyP99Us: 300,
+                latenessP50Us: 1000,
+                latenessP95Us: 4000,
+                latenessP99Us: 9000,
+                audioFilterP50Us: 40,
+                audioFilterP95Us: 90,
+                audioFilterP99Us: 150,
+              ));
+      mock.setHandler('getKeyframes', (_) => <int>[0, 2000, 4000]);
+      mock.setHandler('queueNext', (_) => true);
+      mock.setHandler('setSource', (_) => true);
       mock.install();
     });
 
@@ -201,6 +225,71 @@ void main() {
       expect(mock.log, ['selectSubtitleTrack']);
     });
 
+    // -----------------------------------------------------------------------
+    // Rendering
+    // -----------------------------------------------------------------------
+
+    test('setRenderSize() sends playerId and size', () async {
+      await platform.setRenderSize(1, 320, 180);
+      expect(mock.log, ['setRenderSize']);
+    });
+
+    test('setNativeColorConversion() sends playerId and flag', () async {
+      await platform.setNativeColorConversion(1, true);
+      expect(mock.log, ['setNativeColorConversion']);
+    });
+
+    test('setConversionThreads() sends playerId and thread count', () async {
+      await platform.setConversionThreads(1, 4);
+      expect(mock.log, ['setConversionThreads']);
+    });
+
+    test('getRenderStats() maps message to AVRenderStats', () async {
+      final stats = await platform.getRenderStats(1);
+      expect(stats.framesDecoded, 120);
+      expect(stats.framesPresented, 110);
+      expect(stats.framesDropped, 10);
+      expect(stats.conversion.p50, const Duration(microseconds: 800));
+      expect(stats.copy.p99, const Duration(microseconds: 300));
+      expect(stats.lateness.p95, const Duration(microseconds: 4000));
+      expect(mock.log, ['getRenderStats']);
+    });
+
+    test('getKeyframes() maps milliseconds to durations', () async {
+      final keyframes = await platform.getKeyframes(1);
+      expect(keyframes, const [
+        Duration.zero,
+        Duration(seconds: 2),
+        Duration(seconds: 4),
+      ]);
+      expect(mock.log, ['getKeyframes']);
+    });
+
+    test('queueNext() sends the source and returns the result', () async {
+      final queued = await platform.queueNext(
+        1,
+        const AVVideoSource.network('https://example.com/next.mp4'),
+      );
+      expect(queued, isTrue);
+      expect(mock.log, ['queueNext']);
+    });
+
+    test('preload() sends the source', () async {
+      await platform.preload(
+        const AVVideoSource.network('https://example.com/next.mp4'),
+      );
+      expect(mock.log, ['preload']);
+    });
+
+    test('setSource() sends the source and returns the result', () async {
+      final swapped = await platform.setSource(
+        1,
+        const AVVideoSource.network('https://example.com/next.mp4'),
+      );
+      expect(swapped, isTrue);
+      expect(mock.log, ['setSource']);
+    });
+
     // -----------------------------------------------------------------------
     // Events
     // -----------------------------------------------------------------------
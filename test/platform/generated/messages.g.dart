@@ -20,32 +20,47 @@ class _PigeonCodec extends StandardMessageCodec {
     } else if (value is SourceType) {
       buffer.putUint8(129);
       writeValue(buffer, value.index);
-    } else if (value is VideoSourceMessage) {
+    } else if (value is SeekMode) {
       buffer.putUint8(130);
+      writeValue(buffer, value.index);
+    } else if (value is VideoSourceMessage) {
+      buffer.putUint8(131);
       writeValue(buffer, value.encode());
     } else if (value is MediaMetadataMessage) {
-      buffer.putUint8(131);
+      buffer.putUint8(132);
       writeValue(buffer, value.encode());
     } else if (value is EnterPipRequest) {
-      buffer.putUint8(132);
+      buffer.putUint8(133);
       writeValue(buffer, value.encode());
     } else if (value is MediaMetadataRequest) {
-      buffer.putUint8(133);
+      buffer.putUint8(134);
       writeValue(buffer, value.encode());
     } else if (value is AbrConfigMessage) {
-      buffer.putUint8(134);
+      buffer.putUint8(135);
       writeValue(buffer, value.encode());
     } else if (value is SetAbrConfigRequest) {
-      buffer.putUint8(135);
+      buffer.putUint8(136);
       writeValue(buffer, value.encode());
     } else if (value is DecoderInfoMessage) {
-      buffer.putUint8(136);
+      buffer.putUint8(137);
       writeValue(buffer, value.encode());
     } else if (value is SubtitleTrackMessage) {
-      buffer.putUint8(137);
+      buffer.putUint8(138);
       writeValue(buffer, value.encode());
     } else if (value is SelectSubtitleTrackRequest) {
-      buffer.putUint8(138);
+      buffer.putUint8(139);
+      writeValue(buffer, value.encode());
+    } else if (value is RenderStatsMessage) {
+      buffer.putUint8(140);
+      writeValue(buffer, value.encode());
+    } else if (value is CreateResultMessage) {
+      buffer.putUint8(141);
+      writeValue(buffer, value.encode());
+    } else if (value is ClockAnchorMessage) {
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
+    } else if (value is StateUpdateMessage) {
+      buffer.putUint8(143);
       writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
@@ -59,23 +74,34 @@ class _PigeonCodec extends StandardMessageCodec {
         final int? value = readValue(buffer) as int?;
         return value == null ? null : SourceType.values[value];
       case 130:
-        return VideoSourceMessage.decode(readValue(buffer)!);
+        final int? value = readValue(buffer) as int?;
+        return value == null ? null : SeekMode.values[value];
       case 131:
-        return MediaMetadataMessage.decode(readValue(buffer)!);
+        return VideoSourceMessage.decode(readValue(buffer)!);
       case 132:
-        return EnterPipRequest.decode(readValue(buffer)!);
+        return MediaMetadataMessage.decode(readValue(buffer)!);
       case 133:
-        return MediaMetadataRequest.decode(readValue(buffer)!);
+        return EnterPipRequest.decode(readValue(buffer)!);
       case 134:
-        return AbrConfigMessage.decode(readValue(buffer)!);
+        return MediaMetadataRequest.decode(readValue(buffer)!);
       case 135:
-        return SetAbrConfigRequest.decode(readValue(buffer)!);
+        return AbrConfigMessage.decode(readValue(buffer)!);
       case 136:
-        return DecoderInfoMessage.decode(readValue(buffer)!);
+        return SetAbrConfigRequest.decode(readValue(buffer)!);
       case 137:
-        return SubtitleTrackMessage.decode(readValue(buffer)!);
+        return DecoderInfoMessage.decode(readValue(buffer)!);
       case 138:
+        return SubtitleTrackMessage.decode(readValue(buffer)!);
+      case 139:
         return SelectSubtitleTrackRequest.decode(readValue(buffer)!);
+      case 140:
+        return RenderStatsMessage.decode(readValue(buffer)!);
+      case 141:
+        return CreateResultMessage.decode(readValue(buffer)!);
+      case 142:
+        return ClockAnchorMessage.decode(readValue(buffer)!);
+      case 143:
+        return StateUpdateMessage.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
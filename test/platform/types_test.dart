@@ -198,6 +198,47 @@ void main() {
       );
     });
 
+    test('parses clockAnchor event', () {
+      final event = AVPlayerEvent.fromMap({
+        'type': 'clockAnchor',
+        'position': 5000,
+        'rate': 1.5,
+        'timestamp': 1000000,
+      });
+      expect(event, isA<AVClockAnchorEvent>());
+      final e = event as AVClockAnchorEvent;
+      expect(e.position, const Duration(seconds: 5));
+      expect(e.rate, 1.5);
+      expect(e.timestampUs, 1000000);
+    });
+
+    test('clockAnchor extrapolates the position at its rate', () {
+      const anchor = AVClockAnchorEvent(
+        position: Duration(seconds: 5),
+        rate: 2.0,
+        timestampUs: 1000000,
+      );
+      expect(anchor.positionAt(1500000), const Duration(seconds: 6));
+      expect(
+        const AVClockAnchorEvent(
+          position: Duration(seconds: 1),
+          rate: -4.0,
+          timestampUs: 0,
+        ).positionAt(1000000),
+        Duration.zero,
+      );
+    });
+
+    test('parses stateUpdate event', () {
+      final event = AVPlayerEvent.fromMap({
+        'type': 'stateUpdate',
+        'buffered': 30000,
+      });
+      expect(event, isA<AVStateUpdateEvent>());
+      final e = event as AVStateUpdateEvent;
+      expect(e.buffered, const Duration(seconds: 30));
+    });
+
     test('parses pipChanged event', () {
       final enterEvent = AVPlayerEvent.fromMap({
         'type': 'pipChanged',
@@ -218,6 +259,20 @@ void main() {
       expect(event, isA<AVCompletedEvent>());
     });
 
+    test('parses trackChanged event', () {
+      final event = AVPlayerEvent.fromMap({
+        'type': 'trackChanged',
+        'duration': 90000,
+        'width': 1280.0,
+        'height': 720.0,
+      });
+      expect(event, isA<AVTrackChangedEvent>());
+      final changed = event as AVTrackChangedEvent;
+      expect(changed.duration, const Duration(seconds: 90));
+      expect(changed.width, 1280.0);
+      expect(changed.height, 720.0);
+    });
+
     test('parses error event', () {
       final event = AVPlayerEvent.fromMap({
         'type': 'error',
@@ -444,6 +499,39 @@ void main() {
     });
   });
 
+  // ---------------------------------------------------------------------------
+  // AVRenderStats
+  // ---------------------------------------------------------------------------
+
+  group('AVRenderStats', () {
+    test('stores all fields', () {
+      const stats = AVRenderStats(
+        framesDecoded: 300,
+        framesPresented: 290,
+        framesDropped: 10,
+        conversion: AVLatencyPercentiles(
+          p50: Duration(microseconds: 900),
+          p95: Duration(microseconds: 1400),
+          p99: Duration(microseconds: 2000),
+        ),
+      );
+      expect(stats.framesDecoded, 300);
+      expect(stats.framesPresented, 290);
+      expect(stats.framesDropped, 10);
+      expect(stats.conversion.p95, const Duration(microseconds: 1400));
+      expect(stats.copy, AVLatencyPercentiles.zero);
+    });
+
+    test('empty constant is all zero', () {
+      expect(AVRenderStats.empty.framesDecoded, 0);
+      expect(AVRenderStats.empty.framesPresented, 0);
+      expect(AVRenderStats.empty.framesDropped, 0);
+      expect(AVRenderStats.empty.lateness.p99, Duration.zero);
+      expect(AVRenderStats.empty.audioFilter.p99, Duration.zero);
+      expect(AVRenderStats.empty.createLatency, Duration.zero);
+    });
+  });
+
   // ---------------------------------------------------------------------------
   // AVSubtitleCue / AVSubtitleTrack
   // ---------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include <flutter/plugin_registrar_windows.h>
 #include <flutter/standard_method_codec.h>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -187,8 +188,10 @@ class AvPlayerWindows : public flutter::Plugin,
   // av_player_windows::AvPlayerHostApi implementation
   void Create(
       const av_player_windows::VideoSourceMessage& source,
-      std::function<void(av_player_windows::ErrorOr<int64_t> reply)> result)
-      override;
+      std::function<
+          void(av_player_windows::ErrorOr<av_player_windows::CreateResultMessage>
+                   reply)>
+          result) override;
   void Dispose(
       int64_t player_id,
       std::function<void(std::optional<av_player_windows::FlutterError> reply)>
@@ -204,6 +207,7 @@ class AvPlayerWindows : public flutter::Plugin,
   void SeekTo(
       int64_t player_id,
       int64_t position_ms,
+      const av_player_windows::SeekMode& mode,
       std::function<void(std::optional<av_player_windows::FlutterError> reply)>
           result) override;
   void SetPlaybackSpeed(
@@ -275,6 +279,44 @@ class AvPlayerWindows : public flutter::Plugin,
       const av_player_windows::SelectSubtitleTrackRequest& request,
       std::function<void(std::optional<av_player_windows::FlutterError> reply)>
           result) override;
+  void SetRenderSize(
+      int64_t player_id,
+      int64_t width,
+      int64_t height,
+      std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+          result) override;
+  void SetNativeColorConversion(
+      int64_t player_id,
+      bool enabled,
+      std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+          result) override;
+  void SetConversionThreads(
+      int64_t player_id,
+      int64_t threads,
+      std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+          result) override;
+  void GetRenderStats(
+      int64_t player_id,
+      std::function<void(av_player_windows::ErrorOr<av_player_windows::RenderStatsMessage> reply)>
+          result) override;
+  void GetKeyframes(
+      int64_t player_id,
+      std::function<void(av_player_windows::ErrorOr<flutter::EncodableList> reply)>
+          result) override;
+  void QueueNext(
+      int64_t player_id,
+      const av_player_windows::VideoSourceMessage& source,
+      std::function<void(av_player_windows::ErrorOr<bool> reply)>
+          result) override;
+  void Preload(
+      const av_player_windows::VideoSourceMessage& source,
+      std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+          result) override;
+  void SetSource(
+      int64_t player_id,
+      const av_player_windows::VideoSourceMessage& source,
+      std::function<void(av_player_windows::ErrorOr<bool> reply)>
+          result) override;
 
  private:
   // Build a URI from the VideoSourceMessage.
@@ -407,7 +449,11 @@ std::string AvPlayerWindows::BuildUri(
 
 void AvPlayerWindows::Create(
     const av_player_windows::VideoSourceMessage& source,
-    std::function<void(av_player_windows::ErrorOr<int64_t> reply)> result) {
+    std::function<
+        void(av_player_windows::ErrorOr<av_player_windows::CreateResultMessage>
+                 reply)>
+        result) {
+  auto start = std::chrono::steady_clock::now();
   std::string uri = BuildUri(source);
   if (uri.empty()) {
     result(av_player_windows::FlutterError("INVALID_SOURCE",
@@ -441,7 +487,10 @@ void AvPlayerWindows::Create(
   event_handlers_[texture_id] = std::move(event_handler);
   players_[texture_id] = std::move(player);
 
-  result(texture_id);
+  int64_t latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+  result(av_player_windows::CreateResultMessage(texture_id, latency_us));
 }
 
 void AvPlayerWindows::Dispose(
@@ -495,11 +544,15 @@ void AvPlayerWindows::Pause(
 void AvPlayerWindows::SeekTo(
     int64_t player_id,
     int64_t position_ms,
+    const av_player_windows::SeekMode& mode,
     std::function<void(std::optional<av_player_windows::FlutterError> reply)>
         result) {
   auto it = players_.find(player_id);
   if (it != players_.end()) {
-    it->second->SeekTo(position_ms);
+    // Media Foundation only distinguishes exact and approximate seeks, so
+    // every keyframe mode maps to approximate.
+    it->second->SeekTo(position_ms,
+                       mode != av_player_windows::SeekMode::kAccurate);
   }
   result(std::nullopt);
 }
@@ -692,6 +745,81 @@ void AvPlayerWindows::SelectSubtitleTrack(
   result(std::nullopt);
 }
 
+void AvPlayerWindows::SetRenderSize(
+    int64_t player_id,
+    int64_t width,
+    int64_t height,
+    std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+        result) {
+  auto it = players_.find(player_id);
+  if (it != players_.end()) {
+    it->second->SetRenderSize(static_cast<int>(width),
+                              static_cast<int>(height));
+  }
+  result(std::nullopt);
+}
+
+void AvPlayerWindows::SetNativeColorConversion(
+    int64_t player_id,
+    bool enabled,
+    std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+        result) {
+  // Media Foundation's video processor already outputs BGRA.
+  result(std::nullopt);
+}
+
+void AvPlayerWindows::SetConversionThreads(
+    int64_t player_id,
+    int64_t threads,
+    std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+        result) {
+  // Media Foundation schedules its video processor itself.
+  result(std::nullopt);
+}
+
+void AvPlayerWindows::GetRenderStats(
+    int64_t player_id,
+    std::function<void(av_player_windows::ErrorOr<av_player_windows::RenderStatsMessage> reply)>
+        result) {
+  // Media Foundation does not expose per-frame render timings.
+  result(av_player_windows::RenderStatsMessage(
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+}
+
+void AvPlayerWindows::GetKeyframes(
+    int64_t player_id,
+    std::function<void(av_player_windows::ErrorOr<flutter::EncodableList> reply)>
+        result) {
+  // Media Foundation does not expose the keyframe table.
+  result(flutter::EncodableList());
+}
+
+void AvPlayerWindows::QueueNext(
+    int64_t player_id,
+    const av_player_windows::VideoSourceMessage& source,
+    std::function<void(av_player_windows::ErrorOr<bool> reply)>
+        result) {
+  // Not supported yet; the playlist falls back to a new player.
+  result(false);
+}
+
+void AvPlayerWindows::Preload(
+    const av_player_windows::VideoSourceMessage& source,
+    std::function<void(std::optional<av_player_windows::FlutterError> reply)>
+        result) {
+  // No warm pool yet; Create() loads the source as usual.
+  result(std::nullopt);
+}
+
+void AvPlayerWindows::SetSource(
+    int64_t player_id,
+    const av_player_windows::VideoSourceMessage& source,
+    std::function<void(av_player_windows::ErrorOr<bool> reply)>
+        result) {
+  // Not supported yet; callers create a new player.
+  result(false);
+}
+
 }  // namespace
 
 void AvPlayerWindowsRegisterWithRegistrar(
@@ -3,6 +3,7 @@
 #include <mferror.h>
 #include <mfmediaengine.h>
 
+#include <algorithm>
 #include <sstream>
 
 #pragma comment(lib, "Mfplat.lib")
@@ -73,19 +74,10 @@ STDMETHODIMP MediaPlayer::EventNotify(DWORD event, DWORD_PTR param1,
         video_width_ = static_cast<int>(w);
         video_height_ = static_cast<int>(h);
 
-        // Create D3D11 textures for GPU-accelerated rendering
-        if (video_width_ > 0 && video_height_ > 0) {
-          CreateD3DTextures(video_width_, video_height_);
-        }
-
-        // Allocate pixel buffer
-        {
-          std::lock_guard<std::mutex> lock(buffer_mutex_);
-          pixel_data_.resize(video_width_ * video_height_ * 4, 0);
-          pixel_buffer_.buffer = pixel_data_.data();
-          pixel_buffer_.width = static_cast<size_t>(video_width_);
-          pixel_buffer_.height = static_cast<size_t>(video_height_);
-        }
+        // D3D11 textures and the pixel buffer are sized on the first frame,
+        // once the render size is known.
+        output_width_ = 0;
+        output_height_ = 0;
 
         double duration_sec = media_engine_->GetDuration();
         int64_t duration_ms = static_cast<int64_t>(duration_sec * 1000.0);
@@ -341,8 +333,11 @@ void MediaPlayer::Pause() {
   }
 }
 
-void MediaPlayer::SeekTo(int64_t position_ms) {
-  if (media_engine_) {
+void MediaPlayer::SeekTo(int64_t position_ms, bool approximate) {
+  if (approximate && media_engine_ex_) {
+    media_engine_ex_->SetCurrentTimeEx(position_ms / 1000.0,
+                                       MF_MEDIA_ENGINE_SEEK_MODE_APPROXIMATE);
+  } else if (media_engine_) {
     media_engine_->SetCurrentTime(position_ms / 1000.0);
   }
 }
@@ -386,14 +381,48 @@ void MediaPlayer::SendEvent(const std::string& type,
   event_handler_->SendEvent(event);
 }
 
+void MediaPlayer::SetRenderSize(int width, int height) {
+  std::lock_guard<std::mutex> lock(buffer_mutex_);
+  render_width_ = width;
+  render_height_ = height;
+}
+
+void MediaPlayer::ResizeOutput(int width, int height) {
+  if (width == output_width_ && height == output_height_) return;
+  if (!CreateD3DTextures(width, height)) return;
+  output_width_ = width;
+  output_height_ = height;
+
+  std::lock_guard<std::mutex> lock(buffer_mutex_);
+  pixel_data_.assign(static_cast<size_t>(width) * height * 4, 0);
+  pixel_buffer_.buffer = pixel_data_.data();
+  pixel_buffer_.width = static_cast<size_t>(width);
+  pixel_buffer_.height = static_cast<size_t>(height);
+}
+
 void MediaPlayer::UpdateTexture() {
   if (!media_engine_ || video_width_ == 0 || video_height_ == 0) return;
 
   LONGLONG pts;
   if (media_engine_->OnVideoStreamTick(&pts) == S_OK) {
+    // Fit the native size into the render size, downscaling only.
+    int width = video_width_;
+    int height = video_height_;
+    {
+      std::lock_guard<std::mutex> lock(buffer_mutex_);
+      if (render_width_ > 0 && render_height_ > 0) {
+        double scale =
+            (std::min)({1.0, static_cast<double>(render_width_) / width,
+                        static_cast<double>(render_height_) / height});
+        width = (std::max)(1, static_cast<int>(width * scale + 0.5));
+        height = (std::max)(1, static_cast<int>(height * scale + 0.5));
+      }
+    }
+    ResizeOutput(width, height);
+
     MFVideoNormalizedRect src = {0.0f, 0.0f, 1.0f, 1.0f};
-    RECT dst = {0, 0, static_cast<LONG>(video_width_),
-                static_cast<LONG>(video_height_)};
+    RECT dst = {0, 0, static_cast<LONG>(output_width_),
+                static_cast<LONG>(output_height_)};
     MFARGB border = {0, 0, 0, 255};
 
     if (render_texture_ && staging_texture_ && d3d_context_) {
@@ -410,9 +439,9 @@ void MediaPlayer::UpdateTexture() {
       hr = d3d_context_->Map(staging_texture_, 0, D3D11_MAP_READ, 0, &mapped);
       if (SUCCEEDED(hr)) {
         std::lock_guard<std::mutex> lock(buffer_mutex_);
-        const UINT dst_pitch = static_cast<UINT>(video_width_) * 4;
+        const UINT dst_pitch = static_cast<UINT>(output_width_) * 4;
         const uint8_t* src_data = static_cast<const uint8_t*>(mapped.pData);
-        for (int row = 0; row < video_height_; ++row) {
+        for (int row = 0; row < output_height_; ++row) {
           memcpy(pixel_data_.data() + row * dst_pitch,
                  src_data + row * mapped.RowPitch, dst_pitch);
         }
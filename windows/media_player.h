@@ -35,11 +35,18 @@ class MediaPlayer : public IMFMediaEngineNotify {
   // Playback control.
   void Play();
   void Pause();
-  void SeekTo(int64_t position_ms);
+  // |approximate| lets the engine stop at a nearby keyframe.
+  void SeekTo(int64_t position_ms, bool approximate = false);
   void SetPlaybackSpeed(double speed);
   void SetLooping(bool looping);
   void SetVolume(double volume);
 
+  // Limit frames to |width| x |height| physical pixels. The video processor
+  // scales them in TransferVideoFrame, before the GPU to CPU copy, keeping
+  // the aspect ratio and never upscaling. width or height <= 0 restores
+  // native resolution. Applied on the next frame.
+  void SetRenderSize(int width, int height);
+
   // Set the event handler (can be called after construction).
   void SetEventHandler(EventChannelHandler* handler);
 
@@ -64,6 +71,8 @@ class MediaPlayer : public IMFMediaEngineNotify {
                  const flutter::EncodableMap& extra);
   void UpdateTexture();
   bool CreateD3DTextures(int width, int height);
+  // Recreates the textures and pixel buffer if the output size changed.
+  void ResizeOutput(int width, int height);
 
   flutter::TextureRegistrar* texture_registrar_;
   EventChannelHandler* event_handler_;
@@ -91,6 +100,12 @@ class MediaPlayer : public IMFMediaEngineNotify {
   bool looping_ = false;
   int video_width_ = 0;
   int video_height_ = 0;
+  // Requested by SetRenderSize, guarded by buffer_mutex_.
+  int render_width_ = 0;
+  int render_height_ = 0;
+  // Size of the textures and pixel buffer frames are transferred into.
+  int output_width_ = 0;
+  int output_height_ = 0;
 
   // COM ref count
   long ref_count_ = 1;
@@ -675,6 +675,365 @@ SelectSubtitleTrackRequest SelectSubtitleTrackRequest::FromEncodableList(const E
   return decoded;
 }
 
+// RenderStatsMessage
+
+RenderStatsMessage::RenderStatsMessage(
+  int64_t frames_decoded,
+  int64_t frames_presented,
+  int64_t frames_dropped,
+  int64_t conversion_p50_us,
+  int64_t conversion_p95_us,
+  int64_t conversion_p99_us,
+  int64_t copy_p50_us,
+  int64_t copy_p95_us,
+  int64_t copy_p99_us,
+  int64_t lateness_p50_us,
+  int64_t lateness_p95_us,
+  int64_t lateness_p99_us,
+  int64_t audio_filter_p50_us,
+  int64_t audio_filter_p95_us,
+  int64_t audio_filter_p99_us)
+ : frames_decoded_(frames_decoded),
+    frames_presented_(frames_presented),
+    frames_dropped_(frames_dropped),
+    conversion_p50_us_(conversion_p50_us),
+    conversion_p95_us_(conversion_p95_us),
+    conversion_p99_us_(conversion_p99_us),
+    copy_p50_us_(copy_p50_us),
+    copy_p95_us_(copy_p95_us),
+    copy_p99_us_(copy_p99_us),
+    lateness_p50_us_(lateness_p50_us),
+    lateness_p95_us_(lateness_p95_us),
+    lateness_p99_us_(lateness_p99_us),
+    audio_filter_p50_us_(audio_filter_p50_us),
+    audio_filter_p95_us_(audio_filter_p95_us),
+    audio_filter_p99_us_(audio_filter_p99_us) {}
+
+int64_t RenderStatsMessage::frames_decoded() const {
+  return frames_decoded_;
+}
+
+void RenderStatsMessage::set_frames_decoded(int64_t value_arg) {
+  frames_decoded_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::frames_presented() const {
+  return frames_presented_;
+}
+
+void RenderStatsMessage::set_frames_presented(int64_t value_arg) {
+  frames_presented_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::frames_dropped() const {
+  return frames_dropped_;
+}
+
+void RenderStatsMessage::set_frames_dropped(int64_t value_arg) {
+  frames_dropped_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::conversion_p50_us() const {
+  return conversion_p50_us_;
+}
+
+void RenderStatsMessage::set_conversion_p50_us(int64_t value_arg) {
+  conversion_p50_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::conversion_p95_us() const {
+  return conversion_p95_us_;
+}
+
+void RenderStatsMessage::set_conversion_p95_us(int64_t value_arg) {
+  conversion_p95_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::conversion_p99_us() const {
+  return conversion_p99_us_;
+}
+
+void RenderStatsMessage::set_conversion_p99_us(int64_t value_arg) {
+  conversion_p99_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::copy_p50_us() const {
+  return copy_p50_us_;
+}
+
+void RenderStatsMessage::set_copy_p50_us(int64_t value_arg) {
+  copy_p50_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::copy_p95_us() const {
+  return copy_p95_us_;
+}
+
+void RenderStatsMessage::set_copy_p95_us(int64_t value_arg) {
+  copy_p95_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::copy_p99_us() const {
+  return copy_p99_us_;
+}
+
+void RenderStatsMessage::set_copy_p99_us(int64_t value_arg) {
+  copy_p99_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::lateness_p50_us() const {
+  return lateness_p50_us_;
+}
+
+void RenderStatsMessage::set_lateness_p50_us(int64_t value_arg) {
+  lateness_p50_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::lateness_p95_us() const {
+  return lateness_p95_us_;
+}
+
+void RenderStatsMessage::set_lateness_p95_us(int64_t value_arg) {
+  lateness_p95_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::lateness_p99_us() const {
+  return lateness_p99_us_;
+}
+
+void RenderStatsMessage::set_lateness_p99_us(int64_t value_arg) {
+  lateness_p99_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::audio_filter_p50_us() const {
+  return audio_filter_p50_us_;
+}
+
+void RenderStatsMessage::set_audio_filter_p50_us(int64_t value_arg) {
+  audio_filter_p50_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::audio_filter_p95_us() const {
+  return audio_filter_p95_us_;
+}
+
+void RenderStatsMessage::set_audio_filter_p95_us(int64_t value_arg) {
+  audio_filter_p95_us_ = value_arg;
+}
+
+
+int64_t RenderStatsMessage::audio_filter_p99_us() const {
+  return audio_filter_p99_us_;
+}
+
+void RenderStatsMessage::set_audio_filter_p99_us(int64_t value_arg) {
+  audio_filter_p99_us_ = value_arg;
+}
+
+
+EncodableList RenderStatsMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(15);
+  list.push_back(EncodableValue(frames_decoded_));
+  list.push_back(EncodableValue(frames_presented_));
+  list.push_back(EncodableValue(frames_dropped_));
+  list.push_back(EncodableValue(conversion_p50_us_));
+  list.push_back(EncodableValue(conversion_p95_us_));
+  list.push_back(EncodableValue(conversion_p99_us_));
+  list.push_back(EncodableValue(copy_p50_us_));
+  list.push_back(EncodableValue(copy_p95_us_));
+  list.push_back(EncodableValue(copy_p99_us_));
+  list.push_back(EncodableValue(lateness_p50_us_));
+  list.push_back(EncodableValue(lateness_p95_us_));
+  list.push_back(EncodableValue(lateness_p99_us_));
+  list.push_back(EncodableValue(audio_filter_p50_us_));
+  list.push_back(EncodableValue(audio_filter_p95_us_));
+  list.push_back(EncodableValue(audio_filter_p99_us_));
+  return list;
+}
+
+RenderStatsMessage RenderStatsMessage::FromEncodableList(const EncodableList& list) {
+  RenderStatsMessage decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]),
+    std::get<int64_t>(list[6]),
+    std::get<int64_t>(list[7]),
+    std::get<int64_t>(list[8]),
+    std::get<int64_t>(list[9]),
+    std::get<int64_t>(list[10]),
+    std::get<int64_t>(list[11]),
+    std::get<int64_t>(list[12]),
+    std::get<int64_t>(list[13]),
+    std::get<int64_t>(list[14]));
+  return decoded;
+}
+
+// CreateResultMessage
+
+CreateResultMessage::CreateResultMessage(
+  int64_t player_id,
+  int64_t create_latency_us)
+ : player_id_(player_id),
+    create_latency_us_(create_latency_us) {}
+
+int64_t CreateResultMessage::player_id() const {
+  return player_id_;
+}
+
+void CreateResultMessage::set_player_id(int64_t value_arg) {
+  player_id_ = value_arg;
+}
+
+
+int64_t CreateResultMessage::create_latency_us() const {
+  return create_latency_us_;
+}
+
+void CreateResultMessage::set_create_latency_us(int64_t value_arg) {
+  create_latency_us_ = value_arg;
+}
+
+
+EncodableList CreateResultMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(player_id_));
+  list.push_back(EncodableValue(create_latency_us_));
+  return list;
+}
+
+CreateResultMessage CreateResultMessage::FromEncodableList(const EncodableList& list) {
+  CreateResultMessage decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]));
+  return decoded;
+}
+
+// ClockAnchorMessage
+
+ClockAnchorMessage::ClockAnchorMessage(
+  int64_t player_id,
+  int64_t position_ms,
+  double rate,
+  int64_t timestamp_us)
+ : player_id_(player_id),
+    position_ms_(position_ms),
+    rate_(rate),
+    timestamp_us_(timestamp_us) {}
+
+int64_t ClockAnchorMessage::player_id() const {
+  return player_id_;
+}
+
+void ClockAnchorMessage::set_player_id(int64_t value_arg) {
+  player_id_ = value_arg;
+}
+
+
+int64_t ClockAnchorMessage::position_ms() const {
+  return position_ms_;
+}
+
+void ClockAnchorMessage::set_position_ms(int64_t value_arg) {
+  position_ms_ = value_arg;
+}
+
+
+double ClockAnchorMessage::rate() const {
+  return rate_;
+}
+
+void ClockAnchorMessage::set_rate(double value_arg) {
+  rate_ = value_arg;
+}
+
+
+int64_t ClockAnchorMessage::timestamp_us() const {
+  return timestamp_us_;
+}
+
+void ClockAnchorMessage::set_timestamp_us(int64_t value_arg) {
+  timestamp_us_ = value_arg;
+}
+
+
+EncodableList ClockAnchorMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(EncodableValue(player_id_));
+  list.push_back(EncodableValue(position_ms_));
+  list.push_back(EncodableValue(rate_));
+  list.push_back(EncodableValue(timestamp_us_));
+  return list;
+}
+
+ClockAnchorMessage ClockAnchorMessage::FromEncodableList(const EncodableList& list) {
+  ClockAnchorMessage decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<double>(list[2]),
+    std::get<int64_t>(list[3]));
+  return decoded;
+}
+
+// StateUpdateMessage
+
+StateUpdateMessage::StateUpdateMessage(
+  int64_t player_id,
+  int64_t buffered_ms)
+ : player_id_(player_id),
+    buffered_ms_(buffered_ms) {}
+
+int64_t StateUpdateMessage::player_id() const {
+  return player_id_;
+}
+
+void StateUpdateMessage::set_player_id(int64_t value_arg) {
+  player_id_ = value_arg;
+}
+
+
+int64_t StateUpdateMessage::buffered_ms() const {
+  return buffered_ms_;
+}
+
+void StateUpdateMessage::set_buffered_ms(int64_t value_arg) {
+  buffered_ms_ = value_arg;
+}
+
+
+EncodableList StateUpdateMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(player_id_));
+  list.push_back(EncodableValue(buffered_ms_));
+  return list;
+}
+
+StateUpdateMessage StateUpdateMessage::FromEncodableList(const EncodableList& list) {
+  StateUpdateMessage decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]));
+  return decoded;
+}
+
 
 PigeonInternalCodecSerializer::PigeonInternalCodecSerializer() {}
 
@@ -688,32 +1047,49 @@ EncodableValue PigeonInternalCodecSerializer::ReadValueOfType(
         return encodable_enum_arg.IsNull() ? EncodableValue() : CustomEncodableValue(static_cast<SourceType>(enum_arg_value));
       }
     case 130: {
-        return CustomEncodableValue(VideoSourceMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        const auto& encodable_enum_arg = ReadValue(stream);
+        const int64_t enum_arg_value = encodable_enum_arg.IsNull() ? 0 : encodable_enum_arg.LongValue();
+        return encodable_enum_arg.IsNull() ? EncodableValue() : CustomEncodableValue(static_cast<SeekMode>(enum_arg_value));
       }
     case 131: {
-        return CustomEncodableValue(MediaMetadataMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        return CustomEncodableValue(VideoSourceMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
     case 132: {
-        return CustomEncodableValue(EnterPipRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        return CustomEncodableValue(MediaMetadataMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
     case 133: {
-        return CustomEncodableValue(MediaMetadataRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        return CustomEncodableValue(EnterPipRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
     case 134: {
-        return CustomEncodableValue(AbrConfigMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        return CustomEncodableValue(MediaMetadataRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
     case 135: {
-        return CustomEncodableValue(SetAbrConfigRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        return CustomEncodableValue(AbrConfigMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
     case 136: {
-        return CustomEncodableValue(DecoderInfoMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        return CustomEncodableValue(SetAbrConfigRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
     case 137: {
-        return CustomEncodableValue(SubtitleTrackMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        return CustomEncodableValue(DecoderInfoMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
     case 138: {
+        return CustomEncodableValue(SubtitleTrackMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 139: {
         return CustomEncodableValue(SelectSubtitleTrackRequest::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
+    case 140: {
+        return CustomEncodableValue(RenderStatsMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 141: {
+        return CustomEncodableValue(CreateResultMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 142: {
+        return CustomEncodableValue(ClockAnchorMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 143: {
+        return CustomEncodableValue(StateUpdateMessage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
     default:
       return flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
     }
@@ -728,51 +1104,76 @@ void PigeonInternalCodecSerializer::WriteValue(
       WriteValue(EncodableValue(static_cast<int>(std::any_cast<SourceType>(*custom_value))), stream);
       return;
     }
-    if (custom_value->type() == typeid(VideoSourceMessage)) {
+    if (custom_value->type() == typeid(SeekMode)) {
       stream->WriteByte(130);
+      WriteValue(EncodableValue(static_cast<int>(std::any_cast<SeekMode>(*custom_value))), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(VideoSourceMessage)) {
+      stream->WriteByte(131);
       WriteValue(EncodableValue(std::any_cast<VideoSourceMessage>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(MediaMetadataMessage)) {
-      stream->WriteByte(131);
+      stream->WriteByte(132);
       WriteValue(EncodableValue(std::any_cast<MediaMetadataMessage>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(EnterPipRequest)) {
-      stream->WriteByte(132);
+      stream->WriteByte(133);
       WriteValue(EncodableValue(std::any_cast<EnterPipRequest>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(MediaMetadataRequest)) {
-      stream->WriteByte(133);
+      stream->WriteByte(134);
       WriteValue(EncodableValue(std::any_cast<MediaMetadataRequest>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(AbrConfigMessage)) {
-      stream->WriteByte(134);
+      stream->WriteByte(135);
       WriteValue(EncodableValue(std::any_cast<AbrConfigMessage>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(SetAbrConfigRequest)) {
-      stream->WriteByte(135);
+      stream->WriteByte(136);
       WriteValue(EncodableValue(std::any_cast<SetAbrConfigRequest>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(DecoderInfoMessage)) {
-      stream->WriteByte(136);
+      stream->WriteByte(137);
       WriteValue(EncodableValue(std::any_cast<DecoderInfoMessage>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(SubtitleTrackMessage)) {
-      stream->WriteByte(137);
+      stream->WriteByte(138);
       WriteValue(EncodableValue(std::any_cast<SubtitleTrackMessage>(*custom_value).ToEncodableList()), stream);
       return;
     }
     if (custom_value->type() == typeid(SelectSubtitleTrackRequest)) {
-      stream->WriteByte(138);
+      stream->WriteByte(139);
       WriteValue(EncodableValue(std::any_cast<SelectSubtitleTrackRequest>(*custom_value).ToEncodableList()), stream);
       return;
     }
+    if (custom_value->type() == typeid(RenderStatsMessage)) {
+      stream->WriteByte(140);
+      WriteValue(EncodableValue(std::any_cast<RenderStatsMessage>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(CreateResultMessage)) {
+      stream->WriteByte(141);
+      WriteValue(EncodableValue(std::any_cast<CreateResultMessage>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(ClockAnchorMessage)) {
+      stream->WriteByte(142);
+      WriteValue(EncodableValue(std::any_cast<ClockAnchorMessage>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(StateUpdateMessage)) {
+      stream->WriteByte(143);
+      WriteValue(EncodableValue(std::any_cast<StateUpdateMessage>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
   }
   flutter::StandardCodecSerializer::WriteValue(value, stream);
 }
@@ -806,13 +1207,13 @@ void AvPlayerHostApi::SetUp(
             return;
           }
           const auto& source_arg = std::any_cast<const VideoSourceMessage&>(std::get<CustomEncodableValue>(encodable_source_arg));
-          api->Create(source_arg, [reply](ErrorOr<int64_t>&& output) {
+          api->Create(source_arg, [reply](ErrorOr<CreateResultMessage>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -928,7 +1329,13 @@ void AvPlayerHostApi::SetUp(
             return;
           }
           const int64_t position_ms_arg = encodable_position_ms_arg.LongValue();
-          api->SeekTo(player_id_arg, position_ms_arg, [reply](std::optional<FlutterError>&& output) {
+          const auto& encodable_mode_arg = args.at(2);
+          if (encodable_mode_arg.IsNull()) {
+            reply(WrapError("mode_arg unexpectedly null."));
+            return;
+          }
+          const auto& mode_arg = std::any_cast<const SeekMode&>(std::get<CustomEncodableValue>(encodable_mode_arg));
+          api->SeekTo(player_id_arg, position_ms_arg, mode_arg, [reply](std::optional<FlutterError>&& output) {
             if (output.has_value()) {
               reply(WrapError(output.value()));
               return;
@@ -1441,6 +1848,274 @@ void AvPlayerHostApi::SetUp(
       channel.SetMessageHandler(nullptr);
     }
   }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setRenderSize" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_player_id_arg = args.at(0);
+          if (encodable_player_id_arg.IsNull()) {
+            reply(WrapError("player_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t player_id_arg = encodable_player_id_arg.LongValue();
+          const auto& encodable_width_arg = args.at(1);
+          if (encodable_width_arg.IsNull()) {
+            reply(WrapError("width_arg unexpectedly null."));
+            return;
+          }
+          const int64_t width_arg = encodable_width_arg.LongValue();
+          const auto& encodable_height_arg = args.at(2);
+          if (encodable_height_arg.IsNull()) {
+            reply(WrapError("height_arg unexpectedly null."));
+            return;
+          }
+          const int64_t height_arg = encodable_height_arg.LongValue();
+          api->SetRenderSize(player_id_arg, width_arg, height_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setNativeColorConversion" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_player_id_arg = args.at(0);
+          if (encodable_player_id_arg.IsNull()) {
+            reply(WrapError("player_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t player_id_arg = encodable_player_id_arg.LongValue();
+          const auto& encodable_enabled_arg = args.at(1);
+          if (encodable_enabled_arg.IsNull()) {
+            reply(WrapError("enabled_arg unexpectedly null."));
+            return;
+          }
+          const auto& enabled_arg = std::get<bool>(encodable_enabled_arg);
+          api->SetNativeColorConversion(player_id_arg, enabled_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setConversionThreads" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_player_id_arg = args.at(0);
+          if (encodable_player_id_arg.IsNull()) {
+            reply(WrapError("player_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t player_id_arg = encodable_player_id_arg.LongValue();
+          const auto& encodable_threads_arg = args.at(1);
+          if (encodable_threads_arg.IsNull()) {
+            reply(WrapError("threads_arg unexpectedly null."));
+            return;
+          }
+          const int64_t threads_arg = encodable_threads_arg.LongValue();
+          api->SetConversionThreads(player_id_arg, threads_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.getRenderStats" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_player_id_arg = args.at(0);
+          if (encodable_player_id_arg.IsNull()) {
+            reply(WrapError("player_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t player_id_arg = encodable_player_id_arg.LongValue();
+          api->GetRenderStats(player_id_arg, [reply](ErrorOr<RenderStatsMessage>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.getKeyframes" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_player_id_arg = args.at(0);
+          if (encodable_player_id_arg.IsNull()) {
+            reply(WrapError("player_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t player_id_arg = encodable_player_id_arg.LongValue();
+          api->GetKeyframes(player_id_arg, [reply](ErrorOr<flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.queueNext" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_player_id_arg = args.at(0);
+          if (encodable_player_id_arg.IsNull()) {
+            reply(WrapError("player_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t player_id_arg = encodable_player_id_arg.LongValue();
+          const auto& encodable_source_arg = args.at(1);
+          if (encodable_source_arg.IsNull()) {
+            reply(WrapError("source_arg unexpectedly null."));
+            return;
+          }
+          const auto& source_arg = std::any_cast<const VideoSourceMessage&>(std::get<CustomEncodableValue>(encodable_source_arg));
+          api->QueueNext(player_id_arg, source_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.preload" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_source_arg = args.at(0);
+          if (encodable_source_arg.IsNull()) {
+            reply(WrapError("source_arg unexpectedly null."));
+            return;
+          }
+          const auto& source_arg = std::any_cast<const VideoSourceMessage&>(std::get<CustomEncodableValue>(encodable_source_arg));
+          api->Preload(source_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.av_player.AvPlayerHostApi.setSource" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_player_id_arg = args.at(0);
+          if (encodable_player_id_arg.IsNull()) {
+            reply(WrapError("player_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t player_id_arg = encodable_player_id_arg.LongValue();
+          const auto& encodable_source_arg = args.at(1);
+          if (encodable_source_arg.IsNull()) {
+            reply(WrapError("source_arg unexpectedly null."));
+            return;
+          }
+          const auto& source_arg = std::any_cast<const VideoSourceMessage&>(std::get<CustomEncodableValue>(encodable_source_arg));
+          api->SetSource(player_id_arg, source_arg, [reply](ErrorOr<bool>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
 }
 
 EncodableValue AvPlayerHostApi::WrapError(std::string_view error_message) {
@@ -1459,4 +2134,69 @@ EncodableValue AvPlayerHostApi::WrapError(const FlutterError& error) {
   });
 }
 
+// Generated class from Pigeon that represents Flutter messages that can be called from C++.
+AvPlayerEventApi::AvPlayerEventApi(flutter::BinaryMessenger* binary_messenger)
+ : binary_messenger_(binary_messenger),
+    message_channel_suffix_("") {}
+
+AvPlayerEventApi::AvPlayerEventApi(
+  flutter::BinaryMessenger* binary_messenger,
+  const std::string& message_channel_suffix)
+ : binary_messenger_(binary_messenger),
+    message_channel_suffix_(message_channel_suffix.length() > 0 ? std::string(".") + message_channel_suffix : "") {}
+
+const flutter::StandardMessageCodec& AvPlayerEventApi::GetCodec() {
+  return flutter::StandardMessageCodec::GetInstance(&PigeonInternalCodecSerializer::GetInstance());
+}
+
+void AvPlayerEventApi::OnClockAnchor(
+  const ClockAnchorMessage& anchor_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.av_player.AvPlayerEventApi.onClockAnchor" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    CustomEncodableValue(anchor_arg),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
+void AvPlayerEventApi::OnStateUpdate(
+  const StateUpdateMessage& update_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.av_player.AvPlayerEventApi.onStateUpdate" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    CustomEncodableValue(update_arg),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
 }  // namespace av_player_windows
@@ -49,6 +49,7 @@ template<class T> class ErrorOr {
 
  private:
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   ErrorOr() = default;
   T TakeValue() && { return std::get<T>(std::move(v_)); }
 
@@ -62,6 +63,13 @@ enum class SourceType {
   kFile = 2
 };
 
+enum class SeekMode {
+  kAccurate = 0,
+  kKeyframeBefore = 1,
+  kKeyframeAfter = 2,
+  kNearestKeyframe = 3
+};
+
 
 // Generated class from Pigeon that represents data sent in messages.
 class VideoSourceMessage {
@@ -101,6 +109,7 @@ class VideoSourceMessage {
   static VideoSourceMessage FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   SourceType type_;
   std::optional<std::string> url_;
@@ -146,6 +155,7 @@ class MediaMetadataMessage {
   flutter::EncodableList ToEncodableList() const;
   friend class MediaMetadataRequest;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   std::optional<std::string> title_;
   std::optional<std::string> artist_;
@@ -178,6 +188,7 @@ class EnterPipRequest {
   static EnterPipRequest FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   int64_t player_id_;
   std::optional<double> aspect_ratio_;
@@ -209,6 +220,7 @@ class MediaMetadataRequest {
   static MediaMetadataRequest FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   int64_t player_id_;
   std::unique_ptr<MediaMetadataMessage> metadata_;
@@ -251,6 +263,7 @@ class AbrConfigMessage {
   flutter::EncodableList ToEncodableList() const;
   friend class SetAbrConfigRequest;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   std::optional<int64_t> max_bitrate_bps_;
   std::optional<int64_t> min_bitrate_bps_;
@@ -284,6 +297,7 @@ class SetAbrConfigRequest {
   static SetAbrConfigRequest FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   int64_t player_id_;
   std::unique_ptr<AbrConfigMessage> config_;
@@ -319,6 +333,7 @@ class DecoderInfoMessage {
   static DecoderInfoMessage FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   bool is_hardware_accelerated_;
   std::optional<std::string> decoder_name_;
@@ -356,6 +371,7 @@ class SubtitleTrackMessage {
   static SubtitleTrackMessage FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   std::string id_;
   std::string label_;
@@ -387,6 +403,7 @@ class SelectSubtitleTrackRequest {
   static SelectSubtitleTrackRequest FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
   friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
   friend class PigeonInternalCodecSerializer;
   int64_t player_id_;
   std::optional<std::string> track_id_;
@@ -394,6 +411,189 @@ class SelectSubtitleTrackRequest {
 };
 
 
+// Generated class from Pigeon that represents data sent in messages.
+class RenderStatsMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit RenderStatsMessage(
+    int64_t frames_decoded,
+    int64_t frames_presented,
+    int64_t frames_dropped,
+    int64_t conversion_p50_us,
+    int64_t conversion_p95_us,
+    int64_t conversion_p99_us,
+    int64_t copy_p50_us,
+    int64_t copy_p95_us,
+    int64_t copy_p99_us,
+    int64_t lateness_p50_us,
+    int64_t lateness_p95_us,
+    int64_t lateness_p99_us,
+    int64_t audio_filter_p50_us,
+    int64_t audio_filter_p95_us,
+    int64_t audio_filter_p99_us);
+
+  int64_t frames_decoded() const;
+  void set_frames_decoded(int64_t value_arg);
+
+  int64_t frames_presented() const;
+  void set_frames_presented(int64_t value_arg);
+
+  int64_t frames_dropped() const;
+  void set_frames_dropped(int64_t value_arg);
+
+  int64_t conversion_p50_us() const;
+  void set_conversion_p50_us(int64_t value_arg);
+
+  int64_t conversion_p95_us() const;
+  void set_conversion_p95_us(int64_t value_arg);
+
+  int64_t conversion_p99_us() const;
+  void set_conversion_p99_us(int64_t value_arg);
+
+  int64_t copy_p50_us() const;
+  void set_copy_p50_us(int64_t value_arg);
+
+  int64_t copy_p95_us() const;
+  void set_copy_p95_us(int64_t value_arg);
+
+  int64_t copy_p99_us() const;
+  void set_copy_p99_us(int64_t value_arg);
+
+  int64_t lateness_p50_us() const;
+  void set_lateness_p50_us(int64_t value_arg);
+
+  int64_t lateness_p95_us() const;
+  void set_lateness_p95_us(int64_t value_arg);
+
+  int64_t lateness_p99_us() const;
+  void set_lateness_p99_us(int64_t value_arg);
+
+  int64_t audio_filter_p50_us() const;
+  void set_audio_filter_p50_us(int64_t value_arg);
+
+  int64_t audio_filter_p95_us() const;
+  void set_audio_filter_p95_us(int64_t value_arg);
+
+  int64_t audio_filter_p99_us() const;
+  void set_audio_filter_p99_us(int64_t value_arg);
+
+
+ private:
+  static RenderStatsMessage FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t frames_decoded_;
+  int64_t frames_presented_;
+  int64_t frames_dropped_;
+  int64_t conversion_p50_us_;
+  int64_t conversion_p95_us_;
+  int64_t conversion_p99_us_;
+  int64_t copy_p50_us_;
+  int64_t copy_p95_us_;
+  int64_t copy_p99_us_;
+  int64_t lateness_p50_us_;
+  int64_t lateness_p95_us_;
+  int64_t lateness_p99_us_;
+  int64_t audio_filter_p50_us_;
+  int64_t audio_filter_p95_us_;
+  int64_t audio_filter_p99_us_;
+
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class CreateResultMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit CreateResultMessage(
+    int64_t player_id,
+    int64_t create_latency_us);
+
+  int64_t player_id() const;
+  void set_player_id(int64_t value_arg);
+
+  int64_t create_latency_us() const;
+  void set_create_latency_us(int64_t value_arg);
+
+
+ private:
+  static CreateResultMessage FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t player_id_;
+  int64_t create_latency_us_;
+
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class ClockAnchorMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit ClockAnchorMessage(
+    int64_t player_id,
+    int64_t position_ms,
+    double rate,
+    int64_t timestamp_us);
+
+  int64_t player_id() const;
+  void set_player_id(int64_t value_arg);
+
+  int64_t position_ms() const;
+  void set_position_ms(int64_t value_arg);
+
+  double rate() const;
+  void set_rate(double value_arg);
+
+  int64_t timestamp_us() const;
+  void set_timestamp_us(int64_t value_arg);
+
+
+ private:
+  static ClockAnchorMessage FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t player_id_;
+  int64_t position_ms_;
+  double rate_;
+  int64_t timestamp_us_;
+
+};
+
+
+// Generated class from Pigeon that represents data sent in messages.
+class StateUpdateMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit StateUpdateMessage(
+    int64_t player_id,
+    int64_t buffered_ms);
+
+  int64_t player_id() const;
+  void set_player_id(int64_t value_arg);
+
+  int64_t buffered_ms() const;
+  void set_buffered_ms(int64_t value_arg);
+
+
+ private:
+  static StateUpdateMessage FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class AvPlayerHostApi;
+  friend class AvPlayerEventApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t player_id_;
+  int64_t buffered_ms_;
+
+};
+
+
 class PigeonInternalCodecSerializer : public flutter::StandardCodecSerializer {
  public:
   PigeonInternalCodecSerializer();
@@ -421,7 +621,7 @@ class AvPlayerHostApi {
   virtual ~AvPlayerHostApi() {}
   virtual void Create(
     const VideoSourceMessage& source,
-    std::function<void(ErrorOr<int64_t> reply)> result) = 0;
+    std::function<void(ErrorOr<CreateResultMessage> reply)> result) = 0;
   virtual void Dispose(
     int64_t player_id,
     std::function<void(std::optional<FlutterError> reply)> result) = 0;
@@ -434,6 +634,7 @@ class AvPlayerHostApi {
   virtual void SeekTo(
     int64_t player_id,
     int64_t position_ms,
+    const SeekMode& mode,
     std::function<void(std::optional<FlutterError> reply)> result) = 0;
   virtual void SetPlaybackSpeed(
     int64_t player_id,
@@ -484,6 +685,36 @@ class AvPlayerHostApi {
   virtual void SelectSubtitleTrack(
     const SelectSubtitleTrackRequest& request,
     std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void SetRenderSize(
+    int64_t player_id,
+    int64_t width,
+    int64_t height,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void SetNativeColorConversion(
+    int64_t player_id,
+    bool enabled,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void SetConversionThreads(
+    int64_t player_id,
+    int64_t threads,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void GetRenderStats(
+    int64_t player_id,
+    std::function<void(ErrorOr<RenderStatsMessage> reply)> result) = 0;
+  virtual void GetKeyframes(
+    int64_t player_id,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  virtual void QueueNext(
+    int64_t player_id,
+    const VideoSourceMessage& source,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
+  virtual void Preload(
+    const VideoSourceMessage& source,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void SetSource(
+    int64_t player_id,
+    const VideoSourceMessage& source,
+    std::function<void(ErrorOr<bool> reply)> result) = 0;
 
   // The codec used by AvPlayerHostApi.
   static const flutter::StandardMessageCodec& GetCodec();
@@ -502,5 +733,26 @@ class AvPlayerHostApi {
   AvPlayerHostApi() = default;
 
 };
+// Generated class from Pigeon that represents Flutter messages that can be called from C++.
+class AvPlayerEventApi {
+ public:
+  AvPlayerEventApi(flutter::BinaryMessenger* binary_messenger);
+  AvPlayerEventApi(
+    flutter::BinaryMessenger* binary_messenger,
+    const std::string& message_channel_suffix);
+  static const flutter::StandardMessageCodec& GetCodec();
+  void OnClockAnchor(
+    const ClockAnchorMessage& anchor,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
+  void OnStateUpdate(
+    const StateUpdateMessage& update,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
+ private:
+  flutter::BinaryMessenger* binary_messenger_;
+  std::string message_channel_suffix_;
+};
+
 }  // namespace av_player_windows
 #endif  // PIGEON_MESSAGES_G_H_